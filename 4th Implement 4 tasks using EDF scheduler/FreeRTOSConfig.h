@@ -32,23 +32,46 @@
 #include "GPIO.h"
 #include <string.h>			 
 
-//Variables for Run-time analysis
-extern uint32_t Tin_Button1;
-extern uint32_t Tin_Button2;
-extern uint32_t Tin_Periodic_Transmitter;
-extern uint32_t Tin_UART_Reciever;
-extern uint32_t Tin_Load1;
-extern uint32_t Tin_Load2;
-
-extern uint32_t Tout_Button1;
-extern uint32_t Tout_Button2;
-extern uint32_t Tout_Periodic_Transmitter;
-extern uint32_t Tout_UART_Reciever;
-extern uint32_t Tout_Load1;
-extern uint32_t Tout_Load2;
- 
-extern uint32_t Total_execution_time;
-extern uint32_t CPU_Load;
+//Run-time analysis
+/* E.C. : Every task is bound to a trace slot when it is created, and its slot
+is kept in the task number so the context switch hooks need no search.  The
+slots are defined in main.c. */
+typedef struct xTRACE_SLOT
+{
+	const char * pcTaskName;		/* Name of the task bound to the slot. */
+	pinX_t xPin;					/* Pin of PORT_0 high while the task runs, none in slot 0. */
+	uint32_t ulTin;					/* T1TC when the task last switched in. */
+	uint32_t ulTout;				/* T1TC when the task last switched out. */
+	uint32_t ulExecutionTime;		/* T1TC counts spent running in total. */
+} TraceSlot_t;
+
+extern TraceSlot_t xTraceSlots[];
+
+/* E.C. : Slot of the tasks not listed in main.c.  They drive no pin, as when
+the pins were picked by task name. */
+#define TRACE_OTHER_SLOT	( 0 )
+extern uint32_t ulTraceSlotOfTask( const char * pcTaskName );
+extern uint32_t ulTraceGetCPULoad( void );
+
+/* E.C. : Scheduler events kept in the trace ring buffer of main.c.  The value
+stored with each event is given in brackets. */
+#define TRACE_SWITCH_IN		( 1 )	/* tick count */
+#define TRACE_SWITCH_OUT	( 2 )	/* tick count */
+#define TRACE_RELEASE		( 3 )	/* tick count */
+#define TRACE_DEADLINE		( 4 )	/* absolute deadline of the job released */
+#define TRACE_BLOCK			( 5 )	/* ticks to wait, portMAX_DELAY for ever */
+#define TRACE_UNBLOCK		( 6 )	/* tick count */
+
+typedef struct xTRACE_RECORD
+{
+	uint32_t ulTimestamp;			/* portGET_RUN_TIME_COUNTER_VALUE() */
+	uint32_t ulValue;				/* Depends on the event, see above. */
+	uint8_t ucEvent;				/* One of the TRACE_ events. */
+	uint8_t ucSlot;					/* Trace slot of the task. */
+	uint16_t usSequence;			/* Low bits of the record number. */
+} TraceRecord_t;
+
+extern void vTraceRecord( uint32_t ulEvent, uint32_t ulSlot, uint32_t ulValue );
 
 /*-----------------------------------------------------------
  * Application specific definitions.
@@ -62,14 +85,31 @@ extern uint32_t CPU_Load;
  * See http://www.freertos.org/a00110.html
  *----------------------------------------------------------*/
 #define configUSE_EDF_SCHEDULER		1 /* E.C. */
+#define configEDF_READY_QUEUE		1 /* E.C. : 0 = deadline sorted list, 1 = binary heap, 2 = deadline buckets */
+#define configEDF_MAX_TASKS		64 /* E.C. : most tasks that exist at once, idle and timer tasks included, sizes the ready heap */
+#define configEDF_READY_BUCKETS		64 /* E.C. : buckets in the deadline ring, power of two */
+#define configEDF_BUCKET_SHIFT		2 /* E.C. : each bucket spans 1 << shift ticks */
+#define configEDF_DELAYED_WHEEL_SLOTS	128 /* E.C. : 0 = sorted delayed lists, else ticks covered by the delayed task timing wheel */
+#define configEDF_DEADLINE_MISS_POLICY	0 /* E.C. : 0 = continue, 1 = skip the next job, 2 = abort the job */
+#define configUSE_DEADLINE_MISS_HOOK	0 /* E.C. : call vApplicationDeadlineMissHook( xTask, xLateness ) on each miss */
+#define configEDF_BUDGET_ENFORCEMENT	0 /* E.C. : throttle a job that runs past the budget given at creation */
+#define configEDF_BUDGET_POLICY	0 /* E.C. : 0 = move the job to the background, 1 = defer it to the next release */
+#define configUSE_EDF_SERVERS	0 /* E.C. : constant bandwidth servers for aperiodic tasks, see xTaskServerCreate() */
+#define configEDF_ADMISSION_CONTROL	0 /* E.C. : refuse a task, given its WCET, that would make the task set unschedulable */
+#define configUSE_EDF_SRP	0 /* E.C. : Stack Resource Policy for resources shared by EDF tasks, see vTaskSRPLock() */
+#define configEDF_JOB_CARRIERS	0 /* E.C. : shared stacks for run-to-completion jobs, see xTaskPeriodicJobCreateStatic() */
+#define configEDF_JOB_STACK_DEPTH	100 /* E.C. : words in each of them */
 #define configUSE_PREEMPTION		1
 #define configUSE_IDLE_HOOK			0
 #define configUSE_TICK_HOOK			1
+#define configUSE_TICKLESS_IDLE		1 /* E.C. : stop the tick while only the idle task is ready */
+#define configEXPECTED_IDLE_TIME_BEFORE_SLEEP	2
 #define configCPU_CLOCK_HZ			( ( unsigned long ) 60000000 )	/* =12.0MHz xtal multiplied by 5 using the PLL. */
 #define configTICK_RATE_HZ			( ( TickType_t ) 1000 )
 #define configMAX_PRIORITIES		( 4 )
 #define configMINIMAL_STACK_SIZE	( ( unsigned short ) 90 )
-#define configTOTAL_HEAP_SIZE		( ( size_t ) 13 * 1024 )
+#define configSUPPORT_STATIC_ALLOCATION	1 /* E.C. : tasks and queues in memory given by the application, see main.c */
+#define configSUPPORT_DYNAMIC_ALLOCATION	0 /* E.C. : no heap, so no heap_x.c to link */
 #define configMAX_TASK_NAME_LEN		( 8 )
 #define configUSE_TRACE_FACILITY	1
 #define configUSE_16_BIT_TICKS		0
@@ -99,94 +139,60 @@ to exclude the API function. */
 #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
 #define portGET_RUN_TIME_COUNTER_VALUE()			(T1TC)
 
+/* E.C. : Host simulator build, see posix/port.c.  Set from the compiler command
+line, the port then provides the registers, the timers and the drivers. */
+#ifndef configSIM_POSIX
+	#define configSIM_POSIX		0
+#endif
+
+/* E.C. : Tickless idle, implemented in main.c with a Timer 1 match as the
+wake up source so T1TC keeps counting for the run-time stats */
+extern void vApplicationSleep( uint32_t ulExpectedIdleTime );
+#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )	vApplicationSleep( xExpectedIdleTime )
+
 /*Macros for Readability*/
 #define TASK_NAME			(pxCurrentTCB->pcTaskName) 
 #define SET_P0_PIN(PINx)		GPIO_write( PORT_0 , PINx , PIN_IS_HIGH)
 #define CLR_P0_PIN(PINx)		GPIO_write( PORT_0 , PINx , PIN_IS_LOW)
 
 //trace macros
-#define traceTASK_SWITCHED_IN()		do\
-									{\
-										if(strcmp( pxCurrentTCB->pcTaskName, "Button1") == 0)\
-										{\
-											GPIO_write(PORT_0 , PIN1, PIN_IS_HIGH);\
-											Tin_Button1 = T1TC;\
-										}\
-										else if(strcmp( pxCurrentTCB->pcTaskName, "Button2") == 0)\
-										{\
-											GPIO_write(PORT_0 , PIN2, PIN_IS_HIGH);\
-											Tin_Button2 = T1TC;\
-										}\
-										else if(strcmp( pxCurrentTCB->pcTaskName, "Transmitter") == 0)\
-										{\
-											GPIO_write(PORT_0 , PIN3, PIN_IS_HIGH);\
-											Tin_Periodic_Transmitter = T1TC;\
-										}\
-										else if(strcmp( pxCurrentTCB->pcTaskName, "Receiver") == 0)\
-										{\
-											GPIO_write(PORT_0 , PIN4, PIN_IS_HIGH);\
-											Tin_UART_Reciever = T1TC;\
-										}\
-										else if(strcmp( pxCurrentTCB->pcTaskName, "Load1") == 0)\
-										{\
-											GPIO_write(PORT_0 , PIN5, PIN_IS_HIGH);\
-											Tin_Load1 = T1TC;\
-										}\
-										else if(strcmp( pxCurrentTCB->pcTaskName, "Load2") == 0)\
+/* The first job of a task is released when it is created, or after its
+offset, and traced as any other release. */
+#define traceTASK_CREATE( pxNewTCB )	( pxNewTCB )->uxTaskNumber = ulTraceSlotOfTask( ( pxNewTCB )->pcTaskName )
+
+#define traceTASK_RELEASED( pxTCB )		do\
 										{\
-											GPIO_write(PORT_0 , PIN6, PIN_IS_HIGH);\
-											Tin_Load2 = T1TC;\
+											vTraceRecord( TRACE_RELEASE, ( pxTCB )->uxTaskNumber, xTickCount );\
+											vTraceRecord( TRACE_DEADLINE, ( pxTCB )->uxTaskNumber, ( pxTCB )->xTaskDeadline );\
 										}\
-										else if(strcmp( pxCurrentTCB->pcTaskName, "IDLE") == 0)\
+										while(0)
+
+#define traceTASK_BLOCKED( xTicksToWait )		vTraceRecord( TRACE_BLOCK, pxCurrentTCB->uxTaskNumber, ( xTicksToWait ) )
+
+#define traceTASK_UNBLOCKED( pxTCB )	vTraceRecord( TRACE_UNBLOCK, ( pxTCB )->uxTaskNumber, xTickCount )
+
+#define traceTASK_SWITCHED_IN()		do\
+									{\
+										TraceSlot_t * const pxTraceSlot = &( xTraceSlots[ pxCurrentTCB->uxTaskNumber ] );\
+										if( pxCurrentTCB->uxTaskNumber != TRACE_OTHER_SLOT )\
 										{\
-											GPIO_write(PORT_0 , PIN7, PIN_IS_HIGH);\
+											GPIO_write(PORT_0 , pxTraceSlot->xPin, PIN_IS_HIGH);\
 										}\
+										pxTraceSlot->ulTin = T1TC;\
+										vTraceRecord( TRACE_SWITCH_IN, pxCurrentTCB->uxTaskNumber, xTickCount );\
 									}\
 									while(0)
 										
 #define traceTASK_SWITCHED_OUT()	do\
 									{\
-										if(strcmp( pxCurrentTCB->pcTaskName, "Button1") == 0)\
-										{\
-											GPIO_write(PORT_0 , PIN1, PIN_IS_LOW);\
-											Tout_Button1 = T1TC;\
-											Total_execution_time += Tout_Button1 - Tin_Button1;\
-										}\
-										else if(strcmp( pxCurrentTCB->pcTaskName, "Button2") == 0)\
-										{\
-											GPIO_write(PORT_0 , PIN2, PIN_IS_LOW);\
-											Tout_Button2 = T1TC;\
-											Total_execution_time += Tout_Button2 - Tin_Button2;\
-										}\
-										else if(strcmp( pxCurrentTCB->pcTaskName, "Transmitter") == 0)\
-										{\
-											GPIO_write(PORT_0 , PIN3, PIN_IS_LOW);\
-											Tout_Periodic_Transmitter = T1TC;\
-											Total_execution_time += Tout_Periodic_Transmitter - Tin_Periodic_Transmitter;\
-										}\
-										else if(strcmp( pxCurrentTCB->pcTaskName, "Receiver") == 0)\
-										{\
-											GPIO_write(PORT_0 , PIN4, PIN_IS_LOW);\
-											Tout_UART_Reciever = T1TC;\
-											Total_execution_time += Tout_UART_Reciever - Tin_UART_Reciever;\
-										}\
-										else if(strcmp( pxCurrentTCB->pcTaskName, "Load1") == 0)\
-										{\
-											GPIO_write(PORT_0 , PIN5, PIN_IS_LOW);\
-											Tout_Load1 = T1TC;\
-											Total_execution_time += Tout_Load1 - Tin_Load1;\
-										}\
-										else if(strcmp( pxCurrentTCB->pcTaskName, "Load2") == 0)\
-										{\
-											GPIO_write(PORT_0 , PIN6, PIN_IS_LOW);\
-											Tout_Load2 = T1TC;\
-											Total_execution_time += Tout_Load2 - Tin_Load2;\
-										}\
-										else if(strcmp( pxCurrentTCB->pcTaskName, "IDLE") == 0)\
+										TraceSlot_t * const pxTraceSlot = &( xTraceSlots[ pxCurrentTCB->uxTaskNumber ] );\
+										if( pxCurrentTCB->uxTaskNumber != TRACE_OTHER_SLOT )\
 										{\
-											GPIO_write(PORT_0 , PIN7, PIN_IS_LOW);\
+											GPIO_write(PORT_0 , pxTraceSlot->xPin, PIN_IS_LOW);\
 										}\
-										CPU_Load = ((Total_execution_time * 100) / (T1TC));\
+										pxTraceSlot->ulTout = T1TC;\
+										pxTraceSlot->ulExecutionTime += pxTraceSlot->ulTout - pxTraceSlot->ulTin;\
+										vTraceRecord( TRACE_SWITCH_OUT, pxCurrentTCB->uxTaskNumber, xTickCount );\
 									}\
 									while(0)
 
@@ -0,0 +1,89 @@
+/*
+ * E.C. : Configuration of the scheduler benchmark, see edf_bench.c.
+ *
+ * The kernel is built with the configuration of the application, changed only
+ * where the benchmark needs it.  The scheduler variant comes from the compiler
+ * command line:
+ *     -DbenchEDF=0			fixed priorities, rate monotonic
+ *     -DbenchEDF=1			EDF, with -DbenchREADY_QUEUE=0, 1 or 2 to pick the
+ *							sorted list, the binary heap or the deadline buckets
+ *     -DbenchTICKLESS=0	keep the tick running while idle, so the idle task
+ *							wakes up on every tick instead of sleeping
+ *     -DbenchWHEEL_SLOTS=0	sorted delayed lists instead of the timing wheel
+ */
+
+#ifndef BENCH_FREERTOS_CONFIG_H
+#define BENCH_FREERTOS_CONFIG_H
+
+#include "../FreeRTOSConfig.h"
+
+#ifndef benchEDF
+	#define benchEDF			1
+#endif
+
+#ifndef benchREADY_QUEUE
+	#define benchREADY_QUEUE	1
+#endif
+
+#ifndef benchTICKLESS
+	#define benchTICKLESS		1
+#endif
+
+#ifndef benchWHEEL_SLOTS
+	#define benchWHEEL_SLOTS	128
+#endif
+
+/* Largest task set, the idle task not counted. */
+#define benchMAX_TASKS			512
+
+#undef configUSE_EDF_SCHEDULER
+#define configUSE_EDF_SCHEDULER		benchEDF
+
+#undef configEDF_READY_QUEUE
+#define configEDF_READY_QUEUE		benchREADY_QUEUE
+
+/* The task set and the idle task. */
+#undef configEDF_MAX_TASKS
+#define configEDF_MAX_TASKS			( benchMAX_TASKS + 1 )
+
+/* The bucket ring must span the longest period, benchMAX_PERIOD in
+edf_bench.c, plus the lateness of the jobs. */
+#undef configEDF_READY_BUCKETS
+#define configEDF_READY_BUCKETS		1024
+#undef configEDF_BUCKET_SHIFT
+#define configEDF_BUCKET_SHIFT		2
+
+#undef configEDF_DELAYED_WHEEL_SLOTS
+#define configEDF_DELAYED_WHEEL_SLOTS	benchWHEEL_SLOTS
+
+#undef configUSE_TICKLESS_IDLE
+#define configUSE_TICKLESS_IDLE		benchTICKLESS
+
+/* vApplicationSleep() is in main.c, which the benchmark does not link, so the
+tickless idle of the port is used. */
+#undef portSUPPRESS_TICKS_AND_SLEEP
+
+/* The idle hook counts the turns of the idle task loop. */
+#undef configUSE_IDLE_HOOK
+#define configUSE_IDLE_HOOK			1
+
+/* Levels for the rate monotonic priorities. */
+#undef configMAX_PRIORITIES
+#define configMAX_PRIORITIES		( 32 )
+
+/* The task sets are created at run time, from the heap. */
+#undef configSUPPORT_STATIC_ALLOCATION
+#define configSUPPORT_STATIC_ALLOCATION		0
+#undef configSUPPORT_DYNAMIC_ALLOCATION
+#define configSUPPORT_DYNAMIC_ALLOCATION	1
+#define configTOTAL_HEAP_SIZE		( ( size_t ) 4 * 1024 * 1024 )
+
+/* Only the kernel is measured, the trace of the application is left out. */
+#undef traceTASK_CREATE
+#undef traceTASK_RELEASED
+#undef traceTASK_BLOCKED
+#undef traceTASK_UNBLOCKED
+#undef traceTASK_SWITCHED_IN
+#undef traceTASK_SWITCHED_OUT
+
+#endif /* BENCH_FREERTOS_CONFIG_H */
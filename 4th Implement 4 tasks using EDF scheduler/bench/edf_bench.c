@@ -0,0 +1,328 @@
+/*
+ * E.C. : Scheduler overhead benchmark, run on the host simulator of posix/.
+ *
+ * Generates a synthetic periodic task set: the utilisations of the tasks come
+ * from UUniFast, so they add up to the utilisation asked for, and the periods
+ * are log-uniform between benchMIN_PERIOD and benchMAX_PERIOD ticks.  Every job
+ * steps the simulated clock of the port over its execution time, then waits for
+ * its next release.  The schedule, and so the deadline misses, depend only on
+ * the task set, whatever the speed of the host.  Under EDF the tasks are
+ * created with xTaskPeriodicCreate() and wait with xTaskWaitForNextPeriod(),
+ * otherwise they have rate monotonic priorities and wait with
+ * vTaskDelayUntil().
+ *
+ * The port times xTaskIncrementTick() and vTaskSwitchContext(), and the tasks
+ * time the wait for the next release up to the yield that blocks them.  When the run ends
+ * the percentiles of each, in host cycles, are printed with the number of jobs
+ * that missed their deadline and the number of turns of the idle task loop.
+ *
+ *     edf_bench [tasks [utilisation [ticks [seed]]]]
+ *
+ * Build from the folder above, with $FREERTOS as for posix/port.c and the
+ * scheduler picked as described in bench/FreeRTOSConfig.h:
+ *     cc -std=gnu99 -O2 -DconfigSIM_POSIX=1 -DportSIM_KERNEL_TIMING=1 \
+ *        -DbenchEDF=1 -DbenchREADY_QUEUE=1 \
+ *        -I bench -I posix -I . -I $FREERTOS/include \
+ *        bench/edf_bench.c tasks.c posix/port.c posix/peripherals.c \
+ *        $FREERTOS/list.c $FREERTOS/queue.c $FREERTOS/portable/MemMang/heap_4.c \
+ *        -lpthread -lm -o edf_bench
+ * run_bench.sh builds every variant and runs them over a range of task counts.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define benchMIN_PERIOD			( 10.0 )
+#define benchMAX_PERIOD			( 1000.0 )
+
+#define benchSAMPLES			( 1UL << 20 )
+
+typedef enum
+{
+	eBenchTick = 0,
+	eBenchSwitch,
+	eBenchDelayUntil,
+	eBenchPaths
+} eBenchPath;
+
+typedef struct xBENCH_SAMPLES
+{
+	uint32_t ulCount;
+	uint32_t ulSamples[ benchSAMPLES ];
+} BenchSamples_t;
+
+typedef struct xBENCH_TASK
+{
+	TickType_t xPeriod;
+	TickType_t xRelease;			/* Release of the current job. */
+	uint32_t ulCycles;				/* Execution time of a job, in PCLK cycles. */
+	uint32_t ulJobs;
+	uint32_t ulMisses;
+} BenchTask_t;
+
+static const char * const pcPathNames[ eBenchPaths ] = { "tick", "switch", "delay-until" };
+
+static BenchSamples_t xSamples[ eBenchPaths ];
+static BenchTask_t xTasks[ benchMAX_TASKS ];
+static uint32_t ulTasks = 10;
+static double dUtilisation = 0.7;
+static TickType_t xRunTicks = 10000;
+static uint64_t ullSeed = 1;
+static uint64_t ullRandom;
+static volatile uint64_t ullIdleLoops = 0;
+
+/*-----------------------------------------------------------*/
+
+/* xorshift64*, a run can be repeated from its seed. */
+static double prvRandom( void )
+{
+	ullRandom ^= ullRandom >> 12;
+	ullRandom ^= ullRandom << 25;
+	ullRandom ^= ullRandom >> 27;
+
+	return ( double ) ( ( ullRandom * 0x2545F4914F6CDD1DULL ) >> 11 ) / 9007199254740992.0;
+}
+
+static void prvRecord( eBenchPath ePath, uint64_t ullCycles )
+{
+	BenchSamples_t * const pxSamples = &( xSamples[ ePath ] );
+
+	if( pxSamples->ulCount < benchSAMPLES )
+	{
+		pxSamples->ulSamples[ pxSamples->ulCount++ ] = ( ullCycles > UINT32_MAX ) ? UINT32_MAX : ( uint32_t ) ullCycles;
+	}
+}
+
+/*-----------------------------------------------------------*/
+
+/* UUniFast utilisations and log-uniform periods. */
+static void prvGenerateTaskSet( void )
+{
+	double dLeft = dUtilisation, dNext, dShare;
+	uint32_t ulTask;
+
+	for( ulTask = 0; ulTask < ulTasks; ulTask++ )
+	{
+		if( ulTask < ( ulTasks - 1U ) )
+		{
+			dNext = dLeft * pow( prvRandom(), 1.0 / ( double ) ( ulTasks - 1U - ulTask ) );
+			dShare = dLeft - dNext;
+			dLeft = dNext;
+		}
+		else
+		{
+			dShare = dLeft;
+		}
+
+		xTasks[ ulTask ].xPeriod = ( TickType_t ) lround( exp( log( benchMIN_PERIOD ) + ( prvRandom() * ( log( benchMAX_PERIOD ) - log( benchMIN_PERIOD ) ) ) ) );
+		xTasks[ ulTask ].ulCycles = ( uint32_t ) ( dShare * ( double ) xTasks[ ulTask ].xPeriod * ( double ) ( configCPU_CLOCK_HZ / configTICK_RATE_HZ ) );
+	}
+}
+
+/*-----------------------------------------------------------*/
+
+static void prvPeriodicTask( void * pvParameters )
+{
+	BenchTask_t * const pxTask = ( BenchTask_t * ) pvParameters;
+	uint64_t ullStart;
+
+	for( ;; )
+	{
+		vPortSimStep( pxTask->ulCycles );
+
+		/* The deadline is the next release. */
+		pxTask->ulJobs++;
+
+		if( ( TickType_t ) ( xTaskGetTickCount() - pxTask->xRelease ) >= pxTask->xPeriod )
+		{
+			pxTask->ulMisses++;
+		}
+
+		ullStart = ullPortSimCycleCount();
+
+		#if ( configUSE_EDF_SCHEDULER == 1 )
+			xTaskWaitForNextPeriod();
+			pxTask->xRelease += pxTask->xPeriod;
+		#else
+			xTaskDelayUntil( &( pxTask->xRelease ), pxTask->xPeriod );
+		#endif
+
+		/* A late job does not block, and then does not yield. */
+		if( ullPortSimLastYield() > ullStart )
+		{
+			prvRecord( eBenchDelayUntil, ullPortSimLastYield() - ullStart );
+		}
+	}
+}
+
+/*-----------------------------------------------------------*/
+
+static int prvCompare( const void * pvA, const void * pvB )
+{
+	const uint32_t ulA = *( const uint32_t * ) pvA, ulB = *( const uint32_t * ) pvB;
+
+	return ( ulA > ulB ) - ( ulA < ulB );
+}
+
+static uint32_t prvPercentile( const BenchSamples_t * pxSamples, double dPercent )
+{
+	uint32_t ulIndex = ( uint32_t ) ( ( dPercent / 100.0 ) * ( double ) ( pxSamples->ulCount - 1U ) );
+
+	return pxSamples->ulSamples[ ulIndex ];
+}
+
+static void prvReport( void )
+{
+	static const char * const pcQueues[] = { "sorted-list", "binary-heap", "buckets" };
+	uint32_t ulPath, ulTask, ulJobs = 0, ulMisses = 0;
+	uint64_t ullSum;
+	uint32_t ulSample;
+
+	printf( "scheduler=%s delayed=%s tasks=%u utilisation=%.2f ticks=%u seed=%llu\n",
+			( configUSE_EDF_SCHEDULER == 1 ) ? pcQueues[ configEDF_READY_QUEUE ] : "fixed-priority",
+			( configEDF_DELAYED_WHEEL_SLOTS > 0 ) ? "wheel" : "sorted",
+			ulTasks, dUtilisation, ( unsigned int ) xRunTicks, ( unsigned long long ) ullSeed );
+	printf( "%-12s %9s %9s %9s %9s %9s %9s %9s\n", "cycles", "samples", "mean", "p50", "p90", "p99", "p99.9", "max" );
+
+	for( ulPath = 0; ulPath < eBenchPaths; ulPath++ )
+	{
+		BenchSamples_t * const pxSamples = &( xSamples[ ulPath ] );
+
+		if( pxSamples->ulCount == 0 )
+		{
+			continue;
+		}
+
+		qsort( pxSamples->ulSamples, pxSamples->ulCount, sizeof( uint32_t ), prvCompare );
+
+		for( ullSum = 0, ulSample = 0; ulSample < pxSamples->ulCount; ulSample++ )
+		{
+			ullSum += pxSamples->ulSamples[ ulSample ];
+		}
+
+		printf( "%-12s %9u %9llu %9u %9u %9u %9u %9u\n", pcPathNames[ ulPath ], pxSamples->ulCount,
+				( unsigned long long ) ( ullSum / pxSamples->ulCount ),
+				prvPercentile( pxSamples, 50.0 ), prvPercentile( pxSamples, 90.0 ), prvPercentile( pxSamples, 99.0 ),
+				prvPercentile( pxSamples, 99.9 ), pxSamples->ulSamples[ pxSamples->ulCount - 1U ] );
+	}
+
+	for( ulTask = 0; ulTask < ulTasks; ulTask++ )
+	{
+		ulJobs += xTasks[ ulTask ].ulJobs;
+		ulMisses += xTasks[ ulTask ].ulMisses;
+	}
+
+	printf( "jobs %u, deadline misses %u\n", ulJobs, ulMisses );
+	printf( "idle loops %llu, %.1f per tick\n", ( unsigned long long ) ullIdleLoops, ( double ) ullIdleLoops / ( double ) xRunTicks );
+	fflush( stdout );
+}
+
+/*-----------------------------------------------------------*/
+
+/* Called by the port around the kernel calls it makes. */
+void vPortSimKernelTiming( eSimKernelPath ePath, uint64_t ullCycles )
+{
+	prvRecord( ( ePath == eSimIncrementTick ) ? eBenchTick : eBenchSwitch, ullCycles );
+}
+
+/* Counts the turns of the idle task loop. */
+void vApplicationIdleHook( void )
+{
+	ullIdleLoops++;
+}
+
+/* Ends the run.  The tasks make no library calls, so the report can be
+written from the tick. */
+void vApplicationTickHook( void )
+{
+	if( xTaskGetTickCountFromISR() >= xRunTicks )
+	{
+		prvReport();
+		_exit( 0 );
+	}
+}
+
+int main( int argc, char ** argv )
+{
+	char pcName[ configMAX_TASK_NAME_LEN ];
+	uint32_t ulTask;
+	BaseType_t xCreated;
+
+	if( argc > 1 )
+	{
+		ulTasks = ( uint32_t ) strtoul( argv[ 1 ], NULL, 0 );
+	}
+
+	if( argc > 2 )
+	{
+		dUtilisation = strtod( argv[ 2 ], NULL );
+	}
+
+	if( argc > 3 )
+	{
+		xRunTicks = ( TickType_t ) strtoul( argv[ 3 ], NULL, 0 );
+	}
+
+	if( argc > 4 )
+	{
+		ullSeed = strtoull( argv[ 4 ], NULL, 0 );
+	}
+
+	if( ( ulTasks == 0 ) || ( ulTasks > benchMAX_TASKS ) || ( dUtilisation <= 0.0 ) || ( ullSeed == 0 ) )
+	{
+		fprintf( stderr, "usage: %s [tasks (1-%u) [utilisation [ticks [seed (not 0)]]]]\n", argv[ 0 ], benchMAX_TASKS );
+		return 1;
+	}
+
+	ullRandom = ullSeed;
+	prvGenerateTaskSet();
+
+	for( ulTask = 0; ulTask < ulTasks; ulTask++ )
+	{
+		snprintf( pcName, sizeof( pcName ), "T%u", ulTask );
+
+		/* The first job of every task is released as the scheduler starts. */
+		xTasks[ ulTask ].xRelease = xTaskGetTickCount();
+
+		#if ( configUSE_EDF_SCHEDULER == 1 )
+		{
+			xCreated = xTaskPeriodicCreate( prvPeriodicTask, pcName, configMINIMAL_STACK_SIZE, &( xTasks[ ulTask ] ), 1, NULL, xTasks[ ulTask ].xPeriod );
+		}
+		#else
+		{
+			uint32_t ulShorter, ulOther;
+
+			/* Rate monotonic: the shorter the period, the higher the priority,
+			spread over the priorities above the idle task. */
+			for( ulShorter = 0, ulOther = 0; ulOther < ulTasks; ulOther++ )
+			{
+				if( ( xTasks[ ulOther ].xPeriod < xTasks[ ulTask ].xPeriod ) ||
+					( ( xTasks[ ulOther ].xPeriod == xTasks[ ulTask ].xPeriod ) && ( ulOther < ulTask ) ) )
+				{
+					ulShorter++;
+				}
+			}
+
+			xCreated = xTaskCreate( prvPeriodicTask, pcName, configMINIMAL_STACK_SIZE, &( xTasks[ ulTask ] ),
+									( UBaseType_t ) ( ( configMAX_PRIORITIES - 1 ) - ( ( ulShorter * ( configMAX_PRIORITIES - 1 ) ) / ulTasks ) ), NULL );
+		}
+		#endif
+
+		if( xCreated != pdPASS )
+		{
+			fprintf( stderr, "could not create task %u\n", ulTask );
+			return 1;
+		}
+	}
+
+	vTaskStartScheduler();
+
+	return 1;
+}
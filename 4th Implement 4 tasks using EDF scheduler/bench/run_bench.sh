@@ -0,0 +1,70 @@
+#!/bin/sh
+#
+# E.C. : Builds edf_bench.c for every scheduler variant, each with the sorted
+# delayed lists and with the timing wheel, and runs them over a range of task
+# set sizes, see edf_bench.c.  Then sums up the cost of blocking a job, the
+# delay-until row, for every pair.
+#
+#     FREERTOS=<FreeRTOS V10.4.6 source folder> bench/run_bench.sh [utilisation [ticks [seed]]]
+#
+# Run from the folder above.  Set CC and CFLAGS to change the compiler, and
+# TASKS to the list of task set sizes.
+
+set -e
+
+: "${FREERTOS:?set FREERTOS to the FreeRTOS source folder}"
+CC=${CC:-cc}
+CFLAGS=${CFLAGS:--O2}
+TASKS=${TASKS:-"5 10 50 100 500"}
+UTILISATION=${1:-0.7}
+TICKS=${2:-10000}
+SEED=${3:-1}
+OUT=${OUT:-bench/out}
+
+VARIANTS="fixed-priority sorted-list binary-heap buckets"
+DELAYED="sorted wheel"
+
+mkdir -p "$OUT"
+
+# name, configUSE_EDF_SCHEDULER, configEDF_READY_QUEUE
+for VARIANT in "fixed-priority 0 0" "sorted-list 1 0" "binary-heap 1 1" "buckets 1 2"
+do
+	set -- $VARIANT
+	# name, configEDF_DELAYED_WHEEL_SLOTS
+	for WHEEL in "sorted 0" "wheel 128"
+	do
+		$CC -std=gnu99 $CFLAGS -DconfigSIM_POSIX=1 -DportSIM_KERNEL_TIMING=1 \
+			-DbenchEDF=$2 -DbenchREADY_QUEUE=$3 -DbenchWHEEL_SLOTS=${WHEEL#* } \
+			-I bench -I posix -I . -I "$FREERTOS/include" \
+			bench/edf_bench.c tasks.c posix/port.c posix/peripherals.c \
+			"$FREERTOS/list.c" "$FREERTOS/queue.c" "$FREERTOS/portable/MemMang/heap_4.c" \
+			-lpthread -lm -o "$OUT/edf_bench_$1_${WHEEL% *}"
+	done
+done
+
+for N in $TASKS
+do
+	for VARIANT in $VARIANTS
+	do
+		for WHEEL in $DELAYED
+		do
+			"$OUT/edf_bench_${VARIANT}_$WHEEL" "$N" "$UTILISATION" "$TICKS" "$SEED" | tee "$OUT/${VARIANT}_${WHEEL}_$N.txt"
+			echo
+		done
+	done
+done
+
+printf "%-15s %-8s %-8s %9s %9s %9s %9s\n" "scheduler" "delayed" "tasks" "mean" "p50" "p99" "max"
+
+for N in $TASKS
+do
+	for VARIANT in $VARIANTS
+	do
+		for WHEEL in $DELAYED
+		do
+			awk -v VARIANT="$VARIANT" -v WHEEL="$WHEEL" -v N="$N" \
+				'$1 == "delay-until" { printf "%-15s %-8s %-8s %9s %9s %9s %9s\n", VARIANT, WHEEL, N, $3, $4, $6, $8 }' \
+				"$OUT/${VARIANT}_${WHEEL}_$N.txt"
+		done
+	done
+done
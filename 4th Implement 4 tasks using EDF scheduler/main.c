@@ -76,6 +76,29 @@
 /* Constants for the ComTest demo application tasks. */
 #define mainCOM_TEST_BAUD_RATE	( ( unsigned long ) 115200 )
 
+/* Constants for the trace timer and the tickless idle mode.  Timer 1 runs
+from PCLK divided by mainTIMER1_PRESCALE + 1, Timer 0 generates the RTOS tick
+from the undivided PCLK. */
+#define mainTIMER1_PRESCALE			( ( unsigned long ) 999 )
+#define mainTIMER1_COUNTS_PER_TICK	( configCPU_CLOCK_HZ / ( ( mainTIMER1_PRESCALE + 1UL ) * configTICK_RATE_HZ ) )
+#define mainTIMER1_VIC_CHANNEL		( ( unsigned long ) 5 )
+#define mainMAX_SUPPRESSED_TICKS	( ( TickType_t ) ( 0x7FFFFFFFUL / mainTIMER1_COUNTS_PER_TICK ) )
+#define mainTIMER_ENABLE			( ( unsigned long ) 0x01 )
+#define mainTIMER_MR0_INTERRUPT		( ( unsigned long ) 0x01 )
+#define mainPCON_IDLE				( ( unsigned char ) 0x01 )
+
+/* One turn of the busy loops of the load tasks, 12000 of which take 1ms on the
+target, and the idle mode of the processor.  The host simulator steps its clock
+over the time the turn takes there, and runs it on to the next timer match for
+the idle mode. */
+#if ( configSIM_POSIX == 1 )
+	#define mainLOAD_LOOP_TURN()	vPortSimStep( configCPU_CLOCK_HZ / ( 12000UL * 1000UL ) )
+	#define mainENTER_IDLE_MODE()	vPortSimWaitForInterrupt()
+#else
+	#define mainLOAD_LOOP_TURN()
+	#define mainENTER_IDLE_MODE()	( PCON = mainPCON_IDLE )
+#endif
+
 
 /*
  * Configure the processor for use with the Keil demo board.  This is very
@@ -83,6 +106,12 @@
  * file.
  */
 static void prvSetupHardware( void );
+
+/*
+ * Wakes the processor from the tickless idle sleep.  Only clears the Timer 1
+ * match, the tick count is corrected by vApplicationSleep().
+ */
+static __irq void prvTimer1WakeISR( void );
 /*-----------------------------------------------------------*/
 
 //Tasks Prototypes
@@ -104,23 +133,78 @@ QueueHandle_t Button1_Queue = NULL;
 QueueHandle_t Button2_Queue = NULL;
 QueueHandle_t Periodic_Transmitter_Queue = NULL;			   
 
-//Variables for Run-time analysis
-uint32_t Tin_Button1;
-uint32_t Tin_Button2;
-uint32_t Tin_Periodic_Transmitter;
-uint32_t Tin_UART_Reciever;
-uint32_t Tin_Load1;
-uint32_t Tin_Load2;
-
-uint32_t Tout_Button1;
-uint32_t Tout_Button2;
-uint32_t Tout_Periodic_Transmitter;
-uint32_t Tout_UART_Reciever;
-uint32_t Tout_Load1;
-uint32_t Tout_Load2;
-
-uint32_t Total_execution_time;
-uint32_t CPU_Load;
+//Memory of the tasks and the queues, nothing is taken from a heap
+#define mainTASK_STACK_SIZE		( 100 )	/* Stack size in words, not bytes. */
+#define mainTRANSMITTER_QUEUE_LENGTH	( 14 )
+
+static StaticTask_t Button_1_TCB, Button_2_TCB, Transmitter_TCB, Receiver_TCB, Load1_TCB, Load2_TCB, Idle_TCB;
+static StackType_t Button_1_Stack[ mainTASK_STACK_SIZE ];
+static StackType_t Button_2_Stack[ mainTASK_STACK_SIZE ];
+static StackType_t Transmitter_Stack[ mainTASK_STACK_SIZE ];
+static StackType_t Receiver_Stack[ mainTASK_STACK_SIZE ];
+static StackType_t Load1_Stack[ mainTASK_STACK_SIZE ];
+static StackType_t Load2_Stack[ mainTASK_STACK_SIZE ];
+static StackType_t Idle_Stack[ configMINIMAL_STACK_SIZE ];
+static StaticQueue_t Button1_Queue_Buffer, Button2_Queue_Buffer, Periodic_Transmitter_Queue_Buffer;
+static uint8_t Button1_Queue_Storage[ 1 ];
+static uint8_t Button2_Queue_Storage[ 1 ];
+static uint8_t Periodic_Transmitter_Queue_Storage[ mainTRANSMITTER_QUEUE_LENGTH ];
+
+//Trace slots for Run-time analysis, slot 0 takes any task not listed here
+//and drives no pin, see TRACE_OTHER_SLOT
+#define mainTRACE_SLOTS			( 8 )
+#define mainTRACE_IDLE_SLOT		( 7 )
+
+TraceSlot_t xTraceSlots[ mainTRACE_SLOTS ] =
+{
+	{ "" },
+	{ "Button1",	PIN1 },
+	{ "Button2",	PIN2 },
+	{ "Transmitter",	PIN3 },
+	{ "Receiver",	PIN4 },
+	{ "Load1",		PIN5 },
+	{ "Load2",		PIN6 },
+	{ "IDLE",		PIN7 }
+};
+
+/* Trace ring buffer.  It is laid out so that a memory dump of xTraceBuffer is
+all a host decoder needs: the records, how far they wrapped, the timestamp and
+tick rates and the names of the trace slots.  The records are only written
+from the kernel trace hooks, which run from the tick or with interrupts masked
+or the scheduler suspended, so there is a single writer at any time and no
+lock is needed. */
+#define mainTRACE_RECORDS		( 1024 )	/* Power of two. */
+#define mainTRACE_MAGIC			( 0x54464445UL )	/* "EDFT" */
+#define mainTRACE_STOP_WHEN_FULL	( 0 )	/* 0 = overwrite the oldest records. */
+
+typedef struct xTRACE_BUFFER
+{
+	uint32_t ulMagic;
+	uint32_t ulRecordSize;
+	uint32_t ulRecords;					/* Length of xRecords. */
+	uint32_t ulSlots;					/* Rows of pcSlotNames. */
+	uint32_t ulNameLength;				/* Columns of pcSlotNames. */
+	uint32_t ulTimestampHz;				/* Rate of portGET_RUN_TIME_COUNTER_VALUE(). */
+	uint32_t ulTickHz;
+	volatile uint32_t ulStopWhenFull;	/* Can be changed from the debugger. */
+	volatile uint32_t ulWritten;		/* Records written, the next goes to ulWritten % ulRecords. */
+	char pcSlotNames[ mainTRACE_SLOTS ][ configMAX_TASK_NAME_LEN ];
+	TraceRecord_t xRecords[ mainTRACE_RECORDS ];
+} TraceBuffer_t;
+
+TraceBuffer_t xTraceBuffer =
+{
+	mainTRACE_MAGIC,
+	sizeof( TraceRecord_t ),
+	mainTRACE_RECORDS,
+	mainTRACE_SLOTS,
+	configMAX_TASK_NAME_LEN,
+	configCPU_CLOCK_HZ / ( mainTIMER1_PRESCALE + 1UL ),
+	configTICK_RATE_HZ,
+	mainTRACE_STOP_WHEN_FULL,
+	0,
+	{ "" }
+};
 
 /*
  * Application entry point:
@@ -132,70 +216,82 @@ int main( void )
 	prvSetupHardware();
 
 	//Queues that hold messages
-	Button1_Queue = xQueueCreate(1, sizeof(char));
-	Button2_Queue = xQueueCreate(1, sizeof(char));
-	Periodic_Transmitter_Queue = xQueueCreate(14, sizeof(char));
+	Button1_Queue = xQueueCreateStatic(1, sizeof(char), Button1_Queue_Storage, &Button1_Queue_Buffer);
+	Button2_Queue = xQueueCreateStatic(1, sizeof(char), Button2_Queue_Storage, &Button2_Queue_Buffer);
+	Periodic_Transmitter_Queue = xQueueCreateStatic(mainTRANSMITTER_QUEUE_LENGTH, sizeof(char), Periodic_Transmitter_Queue_Storage, &Periodic_Transmitter_Queue_Buffer);
 	
     /* Create Tasks here */
 	//Button_1_Monitor Task
-	xTaskPeriodicCreate(
+	xTaskPeriodicCreateStatic(
         Button_1_Monitor,        /* Function that implements the task. */
         "Button1",     					/* Text name for the task. */
-        100,      			        	/* Stack size in words, not bytes. */
+        mainTASK_STACK_SIZE,      			        /* Stack size in words, not bytes. */
         ( void * ) 0,         		/* Parameter passed into the task. */
         1,						            /* Priority at which the task is created. */
+        Button_1_Stack,				/* Stack of the task. */
+        &Button_1_TCB,				/* TCB of the task. */
         &Button_1_Handler		    /* Used to pass out the created task's handle. */
-        ,50);      				    /* Task Periodicity */
+        ,50, 50, 0, 0, 0);      				    /* Task Periodicity, deadline, offset, WCET and budget */
 	
 	//Button_2_Monitor Task
-	xTaskPeriodicCreate(
+	xTaskPeriodicCreateStatic(
         Button_2_Monitor,        /* Function that implements the task. */
         "Button2",     					/* Text name for the task. */
-        100,      			        	/* Stack size in words, not bytes. */
+        mainTASK_STACK_SIZE,      			        /* Stack size in words, not bytes. */
         ( void * ) 0,         		/* Parameter passed into the task. */
         1,						            /* Priority at which the task is created. */
+        Button_2_Stack,				/* Stack of the task. */
+        &Button_2_TCB,				/* TCB of the task. */
         &Button_2_Handler		    /* Used to pass out the created task's handle. */
-        ,50);      				    /* Task Periodicity */
+        ,50, 50, 0, 0, 0);      				    /* Task Periodicity, deadline, offset, WCET and budget */
 		
 	//Periodic_Transmitter Task
-	xTaskPeriodicCreate(
+	xTaskPeriodicCreateStatic(
         Periodic_Transmitter,        /* Function that implements the task. */
         "Transmitter",     					/* Text name for the task. */
-        100,      			        	/* Stack size in words, not bytes. */
+        mainTASK_STACK_SIZE,      			        /* Stack size in words, not bytes. */
         ( void * ) 0,         		/* Parameter passed into the task. */
         1,						            /* Priority at which the task is created. */
+        Transmitter_Stack,				/* Stack of the task. */
+        &Transmitter_TCB,				/* TCB of the task. */
         &Transmitter_Handler		    /* Used to pass out the created task's handle. */
-        ,100);      				    /* Task Periodicity */
+        ,100, 100, 0, 0, 0);      				    /* Task Periodicity, deadline, offset, WCET and budget */
 		
 	//Uart_Receiver Task
-	xTaskPeriodicCreate(
+	xTaskPeriodicCreateStatic(
         Uart_Receiver,        /* Function that implements the task. */
         "Receiver",     					/* Text name for the task. */
-        100,      			        	/* Stack size in words, not bytes. */
+        mainTASK_STACK_SIZE,      			        /* Stack size in words, not bytes. */
         ( void * ) 0,         		/* Parameter passed into the task. */
         1,						            /* Priority at which the task is created. */
+        Receiver_Stack,				/* Stack of the task. */
+        &Receiver_TCB,				/* TCB of the task. */
         &Receiver_Handler		    /* Used to pass out the created task's handle. */
-        ,20);      				    /* Task Periodicity */
+        ,20, 20, 0, 0, 0);      				    /* Task Periodicity, deadline, offset, WCET and budget */
 		
 	//Load_1_Simulation Task
-	xTaskPeriodicCreate(
+	xTaskPeriodicCreateStatic(
         Load_1_Simulation,        /* Function that implements the task. */
         "Load1",     					/* Text name for the task. */
-        100,      			        	/* Stack size in words, not bytes. */
+        mainTASK_STACK_SIZE,      			        /* Stack size in words, not bytes. */
         ( void * ) 0,         		/* Parameter passed into the task. */
         1,						            /* Priority at which the task is created. */
+        Load1_Stack,				/* Stack of the task. */
+        &Load1_TCB,				/* TCB of the task. */
         &Load1_Handler		    /* Used to pass out the created task's handle. */
-        ,10);      				    /* Task Periodicity */
+        ,10, 10, 0, 0, 0);      				    /* Task Periodicity, deadline, offset, WCET and budget */
 	
 	//Load_2_Simulation Task
-	xTaskPeriodicCreate(
+	xTaskPeriodicCreateStatic(
         Load_2_Simulation,        /* Function that implements the task. */
         "Load2",     					/* Text name for the task. */
-        100,      			        	/* Stack size in words, not bytes. */
+        mainTASK_STACK_SIZE,      			        /* Stack size in words, not bytes. */
         ( void * ) 0,         		/* Parameter passed into the task. */
         1,						            /* Priority at which the task is created. */
+        Load2_Stack,				/* Stack of the task. */
+        &Load2_TCB,				/* TCB of the task. */
         &Load2_Handler		    /* Used to pass out the created task's handle. */
-        ,100);      				    /* Task Periodicity */	
+        ,100, 100, 0, 0, 0);      				    /* Task Periodicity, deadline, offset, WCET and budget */	
 		
 	
 	/* Now all the tasks have been started - start the scheduler.
@@ -207,12 +303,80 @@ int main( void )
 	these demo application projects then ensure Supervisor mode is used here. */
 	vTaskStartScheduler();
 
-	/* Should never reach here!  If you do then there was not enough heap
-	available for the idle task to be created. */
+	/* Should never reach here! */
 	for( ;; );
 }
 /*-----------------------------------------------------------*/
 
+/* Called by vTaskStartScheduler() for the memory of the idle task. */
+void vApplicationGetIdleTaskMemory( StaticTask_t ** ppxIdleTaskTCBBuffer, StackType_t ** ppxIdleTaskStackBuffer, uint32_t * pulIdleTaskStackSize )
+{
+	*ppxIdleTaskTCBBuffer = &Idle_TCB;
+	*ppxIdleTaskStackBuffer = Idle_Stack;
+	*pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+/*-----------------------------------------------------------*/
+
+/* Called from traceTASK_CREATE() to bind a new task to its trace slot.  The
+name held in the TCB is cut to configMAX_TASK_NAME_LEN - 1 characters, so only
+that much of the slot name is compared. */
+uint32_t ulTraceSlotOfTask( const char * pcTaskName )
+{
+	uint32_t ulSlot;
+	
+	for( ulSlot = TRACE_OTHER_SLOT + 1; ulSlot < mainTRACE_SLOTS; ulSlot++ )
+	{
+		if( strncmp( pcTaskName, xTraceSlots[ ulSlot ].pcTaskName, configMAX_TASK_NAME_LEN - 1 ) == 0 )
+		{
+			strncpy( xTraceBuffer.pcSlotNames[ ulSlot ], pcTaskName, configMAX_TASK_NAME_LEN - 1 );
+			return ulSlot;
+		}
+	}
+	
+	return TRACE_OTHER_SLOT;
+}
+
+/* Append one record to the trace ring buffer. */
+void vTraceRecord( uint32_t ulEvent, uint32_t ulSlot, uint32_t ulValue )
+{
+	const uint32_t ulWritten = xTraceBuffer.ulWritten;
+	TraceRecord_t * pxRecord;
+	
+	if( ( ulWritten >= mainTRACE_RECORDS ) && ( xTraceBuffer.ulStopWhenFull != 0 ) )
+	{
+		return;
+	}
+	
+	pxRecord = &( xTraceBuffer.xRecords[ ulWritten & ( mainTRACE_RECORDS - 1 ) ] );
+	pxRecord->ulTimestamp = portGET_RUN_TIME_COUNTER_VALUE();
+	pxRecord->ulValue = ulValue;
+	pxRecord->ucEvent = ( uint8_t ) ulEvent;
+	pxRecord->ucSlot = ( uint8_t ) ulSlot;
+	pxRecord->usSequence = ( uint16_t ) ulWritten;
+	
+	/* Only count the record once it is complete, so a reader never sees a
+	half written one at the head. */
+	xTraceBuffer.ulWritten = ulWritten + 1;
+}
+
+/* CPU load in percent since timer 1 was started, the idle task excluded.  It
+is worked out here when read rather than on every context switch. */
+uint32_t ulTraceGetCPULoad( void )
+{
+	uint64_t ullExecutionTime = 0;
+	uint32_t ulSlot, ulNow = T1TC;
+	
+	for( ulSlot = 0; ulSlot < mainTRACE_SLOTS; ulSlot++ )
+	{
+		if( ulSlot != mainTRACE_IDLE_SLOT )
+		{
+			ullExecutionTime += xTraceSlots[ ulSlot ].ulExecutionTime;
+		}
+	}
+	
+	return ( ulNow == 0 ) ? 0 : ( uint32_t ) ( ( ullExecutionTime * 100 ) / ulNow );
+}
+
 /* Function to reset timer 1 */
 void timer1Reset(void)
 {
@@ -223,8 +387,98 @@ void timer1Reset(void)
 /* Function to initialize and start timer 1 */
 static void configTimer1(void)
 {
-	T1PR = 1000;
+	T1PR = mainTIMER1_PRESCALE;
 	T1TCR |= 0x1;  
+	
+	/* MR0 of timer 1 is the wake up source of the tickless idle mode, it
+	only interrupts and never resets the counter used by the trace. */
+	VICVectAddr2 = ( unsigned long ) prvTimer1WakeISR;
+	VICVectCntl2 = mainTIMER1_VIC_CHANNEL | 0x20;
+	VICIntEnable = ( 1UL << mainTIMER1_VIC_CHANNEL );
+}
+
+static __irq void prvTimer1WakeISR( void )
+{
+	/* Disarm the match and clear the interrupt. */
+	T1MCR &= ~mainTIMER_MR0_INTERRUPT;
+	T1IR = mainTIMER_MR0_INTERRUPT;
+	VICVectAddr = 0;
+}
+
+/* Tickless idle: called by the idle task with the scheduler suspended when
+only the idle task is ready.  The RTOS tick (timer 0) is stopped and a timer 1
+match is set at the next task release, then the processor waits in idle mode.
+Timer 1 keeps running throughout, so it measures how long the sleep lasted, to
+the PCLK cycle with its prescale counter. */
+void vApplicationSleep( uint32_t ulExpectedIdleTime )
+{
+	uint32_t ulTickPhase, ulCyclesToTickEnd, ulSleepStart, ulPrescaleStart, ulCompleteTicks;
+	uint64_t ullSlept;
+	
+	if( ulExpectedIdleTime > mainMAX_SUPPRESSED_TICKS )
+	{
+		ulExpectedIdleTime = mainMAX_SUPPRESSED_TICKS;
+	}
+	
+	/* Stop the tick, T0TC then holds how far the current tick period got. */
+	T0TCR &= ~mainTIMER_ENABLE;
+	portDISABLE_INTERRUPTS();
+	
+	if( ( eTaskConfirmSleepModeStatus() == eAbortSleep ) || ( ( T0IR & mainTIMER_MR0_INTERRUPT ) != 0 ) )
+	{
+		/* A task became ready after the idle task checked, or a tick is
+		already waiting to be processed.  Restart the tick from where it
+		stopped. */
+		T0TCR |= mainTIMER_ENABLE;
+		portENABLE_INTERRUPTS();
+		return;
+	}
+	
+	ulTickPhase = T0TC;
+	ulCyclesToTickEnd = T0MR0 - ulTickPhase;
+	ulSleepStart = T1TC;
+	ulPrescaleStart = T1PC;
+	
+	/* Wake on the last timer 1 count before the end of the tick period in
+	which the next task is released, the tick is resumed for the cycles left. */
+	T1MR0 = ulSleepStart + ( ( ulCyclesToTickEnd + ulPrescaleStart - 1UL ) / ( mainTIMER1_PRESCALE + 1UL ) ) + ( ( ulExpectedIdleTime - 1UL ) * mainTIMER1_COUNTS_PER_TICK );
+	T1IR = mainTIMER_MR0_INTERRUPT;
+	T1MCR |= mainTIMER_MR0_INTERRUPT;
+	
+	/* The pending interrupt ends the idle mode even though the core does not
+	take it until interrupts are enabled again. */
+	mainENTER_IDLE_MODE();
+	
+	ullSlept = ( ( uint64_t ) ( T1TC - ulSleepStart ) * ( mainTIMER1_PRESCALE + 1UL ) ) + T1PC - ulPrescaleStart;
+	T1MCR &= ~mainTIMER_MR0_INTERRUPT;
+	
+	if( ullSlept < ulCyclesToTickEnd )
+	{
+		/* Woken by another interrupt within the same tick period. */
+		ulCompleteTicks = 0;
+		ulTickPhase += ( uint32_t ) ullSlept;
+	}
+	else
+	{
+		ullSlept -= ulCyclesToTickEnd;
+		ulCompleteTicks = 1UL + ( uint32_t ) ( ullSlept / T0MR0 );
+		ulTickPhase = ( uint32_t ) ( ullSlept % T0MR0 );
+	}
+	
+	if( ulCompleteTicks >= ulExpectedIdleTime )
+	{
+		/* The release is due, leave the last tick to the tick interrupt so
+		the task is unblocked there.  Make that interrupt fire at once. */
+		ulCompleteTicks = ulExpectedIdleTime - 1UL;
+		ulTickPhase = T0MR0 - 1UL;
+	}
+	
+	vTaskStepTick( ulCompleteTicks );
+	
+	/* Resume the tick at the phase reached during the sleep. */
+	T0TC = ulTickPhase;
+	T0TCR |= mainTIMER_ENABLE;
+	portENABLE_INTERRUPTS();
 }
 //Application Tick Hook to monitor every tick
 void vApplicationTickHook (void)
@@ -258,7 +512,6 @@ static void prvSetupHardware( void )
 //Button_1_Monitor Task
 void Button_1_Monitor( void * pvParameters )
 {	
-	TickType_t xLastWakeTime = xTaskGetTickCount();
 	pinState_t Button_1_CurState;
 				
 	//Read GPIO Input for previous buttom 1 state
@@ -303,15 +556,14 @@ void Button_1_Monitor( void * pvParameters )
 		//Make a falling edge to monitor the task's end
 		//GPIO_write(PORT_0 , PIN1, PIN_IS_LOW);
 											  
-		//Delay Button_1_Monitor for 50ms
-		vTaskDelayUntil(&xLastWakeTime , 50);
+		//Wait for the next job of Button_1_Monitor
+		xTaskWaitForNextPeriod();
 	}
 }
 
 //Button_2_Monitor Task
 void Button_2_Monitor( void * pvParameters )
 {
-	TickType_t xLastWakeTime = xTaskGetTickCount();
 	pinState_t Button_2_CurState;
 	
 	//Read GPIO Input for previous buttom 2 state
@@ -356,8 +608,8 @@ void Button_2_Monitor( void * pvParameters )
 		//Make a falling edge to monitor the task's end
 		//GPIO_write(PORT_0 , PIN2, PIN_IS_LOW);
 											  
-		//Delay Button_2_Monitor for 50ms
-		vTaskDelayUntil(&xLastWakeTime , 50);
+		//Wait for the next job of Button_2_Monitor
+		xTaskWaitForNextPeriod();
 	}
 }
 
@@ -365,7 +617,6 @@ void Button_2_Monitor( void * pvParameters )
 void Periodic_Transmitter(void * pvParameters )
 {
 	uint32_t counter = 0;
-	TickType_t xLastWakeTime = xTaskGetTickCount();
 		
 	char Periodic_String[14];
 	strcpy(Periodic_String, "\n100ms string");
@@ -384,8 +635,8 @@ void Periodic_Transmitter(void * pvParameters )
 		//Make a falling edge to monitor the task's end
 		//GPIO_write(PORT_0 , PIN3, PIN_IS_LOW);
 		
-		//Delay Periodic_Transmitter for 100ms
-		vTaskDelayUntil(&xLastWakeTime, 100);
+		//Wait for the next job of Periodic_Transmitter
+		xTaskWaitForNextPeriod();
 	}
 }
 
@@ -393,7 +644,6 @@ void Periodic_Transmitter(void * pvParameters )
 void Uart_Receiver(void * pvParameters )
 {
 	uint32_t counter = 0;
-	TickType_t xLastWakeTime = xTaskGetTickCount();
 		
 	signed char Button1_edge;
 	signed char Button2_edge;
@@ -462,8 +712,8 @@ void Uart_Receiver(void * pvParameters )
 		//Make a falling edge to monitor the task's end
 		//GPIO_write(PORT_0 , PIN4, PIN_IS_LOW);
 		
-		//Delay Uart_Receiver for 20ms
-		vTaskDelayUntil(&xLastWakeTime, 20);
+		//Wait for the next job of Uart_Receiver
+		xTaskWaitForNextPeriod();
 	}
 }
 
@@ -471,7 +721,6 @@ void Uart_Receiver(void * pvParameters )
 void Load_1_Simulation ( void * pvParameters )
 {
 	uint32_t counter = 0;
-	TickType_t xLastWakeTime = xTaskGetTickCount();
 	
 	//Using XTAL = 12Mhz, 1ms = (12*1000*1000)/(1000) = 12000
 	uint32_t _1ms = 12000;
@@ -485,14 +734,14 @@ void Load_1_Simulation ( void * pvParameters )
 		//Represents 5ms of delay (Execution time)
 		for( counter=0 ; counter <= Execution_time ; counter++)
 		{
-			//do nothing
+			mainLOAD_LOOP_TURN();
 		}
 
 		//Make a falling edge to monitor the task's end
 		//GPIO_write(PORT_0 , PIN5, PIN_IS_LOW);
 		
-		//Delay Load_1_Simulation for 10ms
-		vTaskDelayUntil(&xLastWakeTime, 10);
+		//Wait for the next job of Load_1_Simulation
+		xTaskWaitForNextPeriod();
 	}
 }
 
@@ -500,7 +749,6 @@ void Load_1_Simulation ( void * pvParameters )
 void Load_2_Simulation ( void * pvParameters )
 {
 	uint32_t counter = 0;
-	TickType_t xLastWakeTime = xTaskGetTickCount();
 	
 	//Using XTAL = 12Mhz, 1ms = (12*1000*1000)/(1000) = 12000
 	uint32_t _1ms = 12000;
@@ -514,13 +762,13 @@ void Load_2_Simulation ( void * pvParameters )
 		//Represents 12ms of delay (Execution time)
 		for( counter=0 ; counter <= Execution_time ; counter++)
 		{
-			//do nothing
+			mainLOAD_LOOP_TURN();
 		}
 
 		//Make a falling edge to monitor the task's end
 		//GPIO_write(PORT_0 , PIN6, PIN_IS_LOW);
 		
-		//Delay Load_2_Simulation for 100ms
-		vTaskDelayUntil(&xLastWakeTime, 100);
+		//Wait for the next job of Load_2_Simulation
+		xTaskWaitForNextPeriod();
 	}
 }
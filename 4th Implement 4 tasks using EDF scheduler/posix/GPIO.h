@@ -0,0 +1,34 @@
+/*
+ * E.C. : Host stand-in for the GPIO driver of the Keil project.  The pins are
+ * the bits of the IO0PIN and IO1PIN stand-ins of lpc21xx.h, so inputs can be
+ * driven by writing IO1PIN, from a debugger or a stimulus task.
+ */
+
+#ifndef GPIO_H_
+#define GPIO_H_
+
+typedef enum
+{
+	PORT_0,
+	PORT_1
+} portX_t;
+
+typedef enum
+{
+	PIN0, PIN1, PIN2, PIN3, PIN4, PIN5, PIN6, PIN7,
+	PIN8, PIN9, PIN10, PIN11, PIN12, PIN13, PIN14, PIN15,
+	PIN16, PIN17, PIN18, PIN19, PIN20, PIN21, PIN22, PIN23,
+	PIN24, PIN25, PIN26, PIN27, PIN28, PIN29, PIN30, PIN31
+} pinX_t;
+
+typedef enum
+{
+	PIN_IS_LOW,
+	PIN_IS_HIGH
+} pinState_t;
+
+void GPIO_init( void );
+void GPIO_write( portX_t port, pinX_t pin, pinState_t state );
+pinState_t GPIO_read( portX_t port, pinX_t pin );
+
+#endif /* GPIO_H_ */
@@ -0,0 +1,55 @@
+/*
+ * E.C. : Host stand-in for the Keil lpc21xx.h register definitions.
+ *
+ * The registers used by main.c and the drivers are plain variables defined in
+ * peripherals.c.  port.c runs Timer 0 and Timer 1 over them in simulated PCLK
+ * cycles, Timer 1 divided by T1PR + 1 exactly as on the LPC2129, so the trace
+ * timestamps and the run time stats keep their meaning.  Only the match 0
+ * interrupt and reset bits of the MCR registers are emulated, and writes to
+ * T0IR and T1IR store the value written, there is no write one to clear.
+ */
+
+#ifndef __LPC21xx_H
+#define __LPC21xx_H
+
+/* Keil interrupt function qualifier. */
+#define __irq
+
+/* Power control. */
+extern volatile unsigned char PCON;
+extern volatile unsigned long VPBDIV;
+
+/* Vectored interrupt controller. */
+extern volatile unsigned long VICIntEnable;
+extern volatile unsigned long VICVectAddr;
+extern volatile unsigned long VICVectAddr2;
+extern volatile unsigned long VICVectCntl2;
+
+/* Timer 0, the RTOS tick on the target. */
+extern volatile unsigned long T0IR;
+extern volatile unsigned long T0TCR;
+extern volatile unsigned long T0TC;
+extern volatile unsigned long T0PR;
+extern volatile unsigned long T0MCR;
+extern volatile unsigned long T0MR0;
+
+/* Timer 1, the trace timer. */
+extern volatile unsigned long T1IR;
+extern volatile unsigned long T1TC;
+extern volatile unsigned long T1PC;
+extern volatile unsigned long T1TCR;
+extern volatile unsigned long T1PR;
+extern volatile unsigned long T1MCR;
+extern volatile unsigned long T1MR0;
+
+/* General purpose I/O. */
+extern volatile unsigned long IO0PIN;
+extern volatile unsigned long IO0SET;
+extern volatile unsigned long IO0DIR;
+extern volatile unsigned long IO0CLR;
+extern volatile unsigned long IO1PIN;
+extern volatile unsigned long IO1SET;
+extern volatile unsigned long IO1DIR;
+extern volatile unsigned long IO1CLR;
+
+#endif  /* __LPC21xx_H */
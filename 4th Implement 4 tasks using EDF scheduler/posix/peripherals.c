@@ -0,0 +1,85 @@
+/*
+ * E.C. : Host stand-ins for the LPC2129 registers, the GPIO driver and the
+ * UART driver used by main.c.  See port.c.
+ */
+
+#include <string.h>
+#include <unistd.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "lpc21xx.h"
+
+/* Peripheral includes. */
+#include "serial.h"
+#include "GPIO.h"
+
+/* Registers, the timers are run by port.c. */
+volatile unsigned char PCON;
+volatile unsigned long VPBDIV;
+volatile unsigned long VICIntEnable, VICVectAddr, VICVectAddr2, VICVectCntl2;
+volatile unsigned long T0IR, T0TCR, T0TC, T0PR, T0MCR, T0MR0;
+volatile unsigned long T1IR, T1TCR, T1TC, T1PR, T1PC, T1MCR, T1MR0;
+volatile unsigned long IO0PIN, IO0SET, IO0DIR, IO0CLR;
+volatile unsigned long IO1PIN, IO1SET, IO1DIR, IO1CLR;
+
+/*-----------------------------------------------------------*/
+
+void GPIO_init( void )
+{
+	IO0PIN = 0;
+	IO1PIN = 0;
+}
+
+void GPIO_write( portX_t port, pinX_t pin, pinState_t state )
+{
+	volatile unsigned long * const pulPins = ( port == PORT_0 ) ? &IO0PIN : &IO1PIN;
+
+	if( state == PIN_IS_HIGH )
+	{
+		*pulPins |= ( 1UL << pin );
+	}
+	else
+	{
+		*pulPins &= ~( 1UL << pin );
+	}
+}
+
+pinState_t GPIO_read( portX_t port, pinX_t pin )
+{
+	const unsigned long ulPins = ( port == PORT_0 ) ? IO0PIN : IO1PIN;
+
+	return ( ( ulPins & ( 1UL << pin ) ) != 0 ) ? PIN_IS_HIGH : PIN_IS_LOW;
+}
+
+/*-----------------------------------------------------------*/
+
+void xSerialPortInitMinimal( unsigned long ulWantedBaud )
+{
+	( void ) ulWantedBaud;
+}
+
+/* The tick can stop a task anywhere, so the output is written with the tick
+masked and without stdio, whose lock could be held by a stopped task. */
+signed char xSerialPutChar( signed char cOutChar )
+{
+	ssize_t xWritten;
+
+	portENTER_CRITICAL();
+	xWritten = write( STDOUT_FILENO, &cOutChar, 1 );
+	portEXIT_CRITICAL();
+
+	return ( xWritten == 1 ) ? pdPASS : pdFAIL;
+}
+
+void vSerialPutString( const signed char * const pcString, unsigned short usStringLength )
+{
+	ssize_t xWritten;
+
+	/* Callers pass a fixed length, the UART stops at the end of the string. */
+	portENTER_CRITICAL();
+	xWritten = write( STDOUT_FILENO, pcString, strnlen( ( const char * ) pcString, usStringLength ) );
+	portEXIT_CRITICAL();
+
+	( void ) xWritten;
+}
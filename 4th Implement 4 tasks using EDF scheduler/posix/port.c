@@ -0,0 +1,612 @@
+/*
+ * E.C. : Host simulator port.
+ *
+ * Runs the kernel and the application of this folder, unchanged, as a Linux
+ * process, so the EDF scheduler can be run, traced and measured off the target.
+ *
+ * Every task runs on a POSIX thread of its own, and only the thread of
+ * pxCurrentTCB is allowed to run.  The interrupt line of the processor is
+ * SIGALRM, raised by the running thread itself.  Disabling interrupts masks the
+ * signal in the calling thread, so every task keeps its own interrupt state as
+ * on the target, and an interrupt raised while they are disabled is taken when
+ * they are enabled again.  A task switched out by an interrupt simply waits
+ * inside the signal handler until it is selected again.
+ *
+ * Time is simulated, and it only passes when code says so, which makes every
+ * run of the same program the same.  Timer 0, the RTOS tick, and Timer 1, the
+ * trace and run time stats timer, are emulated over the registers of
+ * peripherals.c.  They count simulated PCLK cycles, which pass:
+ * - in vPortSimStep(), which task code calls for the cycles its work takes on
+ *   the target, a spin loop for instance;
+ * - in vPortSimWaitForInterrupt(), which runs the clock on to the next timer
+ *   match, the way the processor sleeps in idle mode.  The idle task calls it
+ *   on every turn of its loop, so idle time passes at once.
+ * Kernel code and task code that does not call vPortSimStep() take no time.
+ *
+ * A task can be stopped by the tick wherever it calls vPortSimStep() or enables
+ * interrupts, so application code must not call C library functions that take
+ * locks, stdio or malloc for instance, around those outside a critical
+ * section.  Where a heap is used, use heap_4.c rather than heap_3.c.
+ *
+ * Build from this folder, with $FREERTOS the FreeRTOS V10.4.6 source folder of
+ * the Keil project (the one holding the task.h with the EDF prototypes):
+ *     cc -std=gnu99 -O2 -DconfigSIM_POSIX=1 -I posix -I . -I $FREERTOS/include \
+ *        main.c tasks.c posix/port.c posix/peripherals.c \
+ *        $FREERTOS/list.c $FREERTOS/queue.c -lpthread -o edf_sim
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <time.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "lpc21xx.h"
+
+/* Stack of the thread that runs a task.  The stack given to the task by the
+kernel only holds the thread structure. */
+#ifndef portSIM_THREAD_STACK_SIZE
+	#define portSIM_THREAD_STACK_SIZE	( 256UL * 1024UL )
+#endif
+
+#define portSIM_CYCLES_PER_TICK			( ( unsigned long ) ( configCPU_CLOCK_HZ / configTICK_RATE_HZ ) )
+#define portSIM_MAX_SUPPRESSED_TICKS	( ( TickType_t ) 1000000UL )
+
+/* Bits of the timer registers, as on the LPC2129. */
+#define portSIM_TIMER_ENABLE			( 0x01UL )		/* TCR */
+#define portSIM_TIMER_RESET				( 0x02UL )		/* TCR */
+#define portSIM_MR0_INTERRUPT			( 0x01UL )		/* MCR and IR */
+#define portSIM_MR0_RESET				( 0x02UL )		/* MCR */
+
+/* No timer match to come. */
+#define portSIM_NO_EVENT				( UINT64_MAX )
+
+/* Timing of the kernel calls made by the port, see portmacro.h. */
+#if ( portSIM_KERNEL_TIMING == 1 )
+	#define portSIM_TIMED( ePath, xCall )	do\
+											{\
+												const uint64_t ullStart = ullPortSimCycleCount();\
+												xCall;\
+												vPortSimKernelTiming( ( ePath ), ullPortSimCycleCount() - ullStart );\
+											}\
+											while( 0 )
+#else
+	#define portSIM_TIMED( ePath, xCall )	xCall
+#endif
+
+/* The thread of a task, kept at the top of the stack of the task. */
+typedef struct xSIM_THREAD
+{
+	pthread_t xThread;
+	pthread_cond_t xResume;			/* Signalled when the task is selected. */
+	TaskFunction_t pxCode;
+	void * pvParameters;
+	volatile BaseType_t xExit;		/* Set when the task is deleted. */
+} SimThread_t;
+
+/* pxTopOfStack, the first member of the TCB, points to the thread. */
+#define portTHREAD_OF( pxTCB )		( *( SimThread_t ** ) ( pxTCB ) )
+
+extern void * volatile pxCurrentTCB;
+
+/* Hand over between the threads. */
+static pthread_mutex_t xRunMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t xSchedulerEnded = PTHREAD_COND_INITIALIZER;
+static SimThread_t * volatile pxRunningThread = NULL;
+static volatile BaseType_t xSchedulerRunning = pdFALSE;
+
+/* Critical section nesting of the task running on the calling thread. */
+static __thread UBaseType_t uxCriticalNesting = 0;
+
+#if ( portSIM_KERNEL_TIMING == 1 )
+	/* When the task running on the calling thread last yielded. */
+	static __thread uint64_t ullLastYield = 0;
+#endif
+
+/* Whether the match interrupt of Timer 1 is waiting to be taken.  Only the
+running thread touches the timers. */
+static BaseType_t xTimer1MatchPending = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+/* The signal goes to the thread that raised it, and stays pending there if the
+thread has interrupts disabled.  When that thread switches out before it enables
+them, the interrupt is raised again by the next thread to enable them.  The
+handler looks at the timers, so taking the signal twice does no harm. */
+static void prvRaisePendingInterrupt( void )
+{
+	if( ( ( T0IR & portSIM_MR0_INTERRUPT ) != 0UL ) || ( xTimer1MatchPending != pdFALSE ) )
+	{
+		raise( SIGALRM );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvMaskTick( int iHow, sigset_t * pxOldMask )
+{
+	sigset_t xTickSignal;
+
+	sigemptyset( &xTickSignal );
+	sigaddset( &xTickSignal, SIGALRM );
+	pthread_sigmask( iHow, &xTickSignal, pxOldMask );
+
+	if( iHow == SIG_UNBLOCK )
+	{
+		prvRaisePendingInterrupt();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvRestoreMask( const sigset_t * pxOldMask )
+{
+	pthread_sigmask( SIG_SETMASK, pxOldMask, NULL );
+	prvRaisePendingInterrupt();
+}
+/*-----------------------------------------------------------*/
+
+/* Cycles from a count to its match, a 32-bit counter that is already on the
+match only gets there again once it wraps. */
+static uint64_t prvCountsToMatch( unsigned long ulCount, unsigned long ulMatch )
+{
+	const uint32_t ulCounts = ( uint32_t ) ulMatch - ( uint32_t ) ulCount;
+
+	return ( ulCounts == 0U ) ? ( ( uint64_t ) 1U << 32 ) : ( uint64_t ) ulCounts;
+}
+/*-----------------------------------------------------------*/
+
+/* Simulated cycles until the next timer match that interrupts or resets a
+timer. */
+static uint64_t prvCyclesToNextEvent( void )
+{
+	uint64_t ullCycles = portSIM_NO_EVENT, ullTimer1;
+	const uint64_t ullTimer1Divider = ( uint64_t ) ( uint32_t ) T1PR + 1U;
+
+	/* Timer 0 counts undivided, T0PR is left at 0 as on the target. */
+	if( ( ( T0TCR & portSIM_TIMER_ENABLE ) != 0UL ) && ( ( T0MCR & ( portSIM_MR0_INTERRUPT | portSIM_MR0_RESET ) ) != 0UL ) )
+	{
+		ullCycles = prvCountsToMatch( T0TC, T0MR0 );
+	}
+
+	if( ( ( T1TCR & portSIM_TIMER_ENABLE ) != 0UL ) && ( ( T1MCR & portSIM_MR0_INTERRUPT ) != 0UL ) )
+	{
+		ullTimer1 = ( ( prvCountsToMatch( T1TC, T1MR0 ) - 1U ) * ullTimer1Divider ) + ( ullTimer1Divider - ( uint32_t ) T1PC );
+
+		if( ullTimer1 < ullCycles )
+		{
+			ullCycles = ullTimer1;
+		}
+	}
+
+	return ullCycles;
+}
+/*-----------------------------------------------------------*/
+
+/* Runs both timers for ullCycles, which must not go past the next event, and
+raises the interrupt if a match at the end of them asks for one. */
+static void prvAdvanceTimers( uint64_t ullCycles )
+{
+	const uint64_t ullTimer1Divider = ( uint64_t ) ( uint32_t ) T1PR + 1U;
+	uint64_t ullTimer1Counts;
+	BaseType_t xInterrupt = pdFALSE;
+
+	if( ( T0TCR & portSIM_TIMER_ENABLE ) != 0UL )
+	{
+		T0TC = ( uint32_t ) ( T0TC + ullCycles );
+
+		if( ( uint32_t ) T0TC == ( uint32_t ) T0MR0 )
+		{
+			if( ( T0MCR & portSIM_MR0_RESET ) != 0UL )
+			{
+				T0TC = 0;
+			}
+
+			if( ( T0MCR & portSIM_MR0_INTERRUPT ) != 0UL )
+			{
+				T0IR |= portSIM_MR0_INTERRUPT;
+				xInterrupt = pdTRUE;
+			}
+		}
+	}
+
+	if( ( T1TCR & portSIM_TIMER_RESET ) != 0UL )
+	{
+		T1TC = 0;
+		T1PC = 0;
+	}
+	else if( ( T1TCR & portSIM_TIMER_ENABLE ) != 0UL )
+	{
+		ullTimer1Counts = ( ( uint32_t ) T1PC + ullCycles ) / ullTimer1Divider;
+		T1PC = ( uint32_t ) ( ( ( uint32_t ) T1PC + ullCycles ) % ullTimer1Divider );
+		T1TC = ( uint32_t ) ( T1TC + ullTimer1Counts );
+
+		if( ( ullTimer1Counts != 0U ) && ( ( uint32_t ) T1TC == ( uint32_t ) T1MR0 ) && ( ( T1MCR & portSIM_MR0_INTERRUPT ) != 0UL ) )
+		{
+			T1IR |= portSIM_MR0_INTERRUPT;
+			xTimer1MatchPending = pdTRUE;
+			xInterrupt = pdTRUE;
+		}
+	}
+
+	if( xInterrupt != pdFALSE )
+	{
+		/* Taken at once, or as soon as the thread enables interrupts. */
+		raise( SIGALRM );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvStep( uint64_t ullCycles )
+{
+	uint64_t ullNext;
+
+	while( ullCycles > 0U )
+	{
+		ullNext = prvCyclesToNextEvent();
+
+		if( ullNext > ullCycles )
+		{
+			ullNext = ullCycles;
+		}
+
+		ullCycles -= ullNext;
+
+		/* The interrupt taken here can switch the task out, the rest of the
+		cycles then pass once it runs again. */
+		prvAdvanceTimers( ullNext );
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* Blocks the calling thread until its task is selected again. */
+static void prvWaitForTurn( SimThread_t * pxThread )
+{
+	BaseType_t xExit;
+
+	pthread_mutex_lock( &xRunMutex );
+
+	while( ( pxRunningThread != pxThread ) && ( pxThread->xExit == pdFALSE ) )
+	{
+		pthread_cond_wait( &( pxThread->xResume ), &xRunMutex );
+	}
+
+	xExit = pxThread->xExit;
+	pthread_mutex_unlock( &xRunMutex );
+
+	if( xExit != pdFALSE )
+	{
+		pthread_exit( NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* Selects the next task and, if it changed, lets its thread run and stops the
+calling one.  Called with the tick masked. */
+static void prvSwitchThreads( void )
+{
+	SimThread_t * const pxFrom = portTHREAD_OF( pxCurrentTCB );
+	SimThread_t * pxTo;
+
+	portSIM_TIMED( eSimSwitchContext, vTaskSwitchContext() );
+	pxTo = portTHREAD_OF( pxCurrentTCB );
+
+	if( pxTo != pxFrom )
+	{
+		pthread_mutex_lock( &xRunMutex );
+		pxRunningThread = pxTo;
+		pthread_cond_signal( &( pxTo->xResume ) );
+		pthread_mutex_unlock( &xRunMutex );
+
+		prvWaitForTurn( pxFrom );
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* The interrupt line.  The Timer 1 match goes to the handler main.c installs
+in VICVectAddr2, the Timer 0 match is the RTOS tick. */
+static void prvInterruptHandler( int iSignal )
+{
+	const int iSavedErrno = errno;
+	BaseType_t xSwitchRequired = pdFALSE;
+
+	( void ) iSignal;
+
+	if( xTimer1MatchPending != pdFALSE )
+	{
+		xTimer1MatchPending = pdFALSE;
+
+		if( VICVectAddr2 != 0UL )
+		{
+			( ( void ( * )( void ) ) VICVectAddr2 )();
+		}
+	}
+
+	if( ( T0IR & portSIM_MR0_INTERRUPT ) != 0UL )
+	{
+		T0IR &= ~portSIM_MR0_INTERRUPT;
+		portSIM_TIMED( eSimIncrementTick, xSwitchRequired = xTaskIncrementTick() );
+	}
+
+	if( xSwitchRequired != pdFALSE )
+	{
+		prvSwitchThreads();
+	}
+
+	errno = iSavedErrno;
+}
+/*-----------------------------------------------------------*/
+
+static void * prvThreadEntry( void * pvParameters )
+{
+	SimThread_t * const pxThread = ( SimThread_t * ) pvParameters;
+
+	prvWaitForTurn( pxThread );
+
+	/* Tasks start with interrupts enabled. */
+	prvMaskTick( SIG_UNBLOCK, NULL );
+	pxThread->pxCode( pxThread->pvParameters );
+
+	/* A task must not return, one that does is deleted. */
+	vTaskDelete( NULL );
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack, TaskFunction_t pxCode, void * pvParameters )
+{
+	SimThread_t * pxThread;
+	pthread_attr_t xAttributes;
+	sigset_t xOldMask;
+	int iResult;
+
+	/* The stack is not used by the task, its top holds the thread. */
+	pxThread = ( SimThread_t * ) ( ( ( portPOINTER_SIZE_TYPE ) ( pxTopOfStack + 1 ) - sizeof( SimThread_t ) ) & ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) );
+	pxThread->pxCode = pxCode;
+	pxThread->pvParameters = pvParameters;
+	pxThread->xExit = pdFALSE;
+	pthread_cond_init( &( pxThread->xResume ), NULL );
+
+	/* The thread inherits the signal mask, start it with the tick masked. */
+	pthread_attr_init( &xAttributes );
+	pthread_attr_setstacksize( &xAttributes, portSIM_THREAD_STACK_SIZE );
+	prvMaskTick( SIG_BLOCK, &xOldMask );
+	iResult = pthread_create( &( pxThread->xThread ), &xAttributes, prvThreadEntry, pxThread );
+	configASSERT( iResult == 0 );
+	( void ) iResult;
+	prvRestoreMask( &xOldMask );
+	pthread_attr_destroy( &xAttributes );
+
+	return ( StackType_t * ) pxThread;
+}
+/*-----------------------------------------------------------*/
+
+void vPortCleanUpTCB( void * pxTCB )
+{
+	SimThread_t * const pxThread = portTHREAD_OF( pxTCB );
+	sigset_t xOldMask;
+
+	/* The thread is waiting for its turn, make it exit before the memory that
+	holds it is freed.  An interrupt taken with xRunMutex held would deadlock
+	on it when it switches tasks. */
+	prvMaskTick( SIG_BLOCK, &xOldMask );
+	pthread_mutex_lock( &xRunMutex );
+	pxThread->xExit = pdTRUE;
+	pthread_cond_signal( &( pxThread->xResume ) );
+	pthread_mutex_unlock( &xRunMutex );
+	prvRestoreMask( &xOldMask );
+
+	pthread_join( pxThread->xThread, NULL );
+	pthread_cond_destroy( &( pxThread->xResume ) );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xPortStartScheduler( void )
+{
+	struct sigaction xAction;
+
+	/* Called with interrupts disabled, the main thread keeps them disabled and
+	only waits for the scheduler to end. */
+	prvMaskTick( SIG_BLOCK, NULL );
+
+	memset( &xAction, 0, sizeof( xAction ) );
+	xAction.sa_handler = prvInterruptHandler;
+	xAction.sa_flags = SA_RESTART;
+	sigemptyset( &xAction.sa_mask );
+	sigaction( SIGALRM, &xAction, NULL );
+
+	/* Timer 0 generates the tick, as set up by the port on the target. */
+	T0TCR = 0;
+	T0PR = 0;
+	T0TC = 0;
+	T0IR = 0;
+	T0MR0 = portSIM_CYCLES_PER_TICK;
+	T0MCR = portSIM_MR0_INTERRUPT | portSIM_MR0_RESET;
+	T0TCR = portSIM_TIMER_ENABLE;
+
+	pthread_mutex_lock( &xRunMutex );
+	xSchedulerRunning = pdTRUE;
+	pxRunningThread = portTHREAD_OF( pxCurrentTCB );
+	pthread_cond_signal( &( pxRunningThread->xResume ) );
+
+	while( xSchedulerRunning != pdFALSE )
+	{
+		pthread_cond_wait( &xSchedulerEnded, &xRunMutex );
+	}
+
+	pthread_mutex_unlock( &xRunMutex );
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+	SimThread_t * const pxThread = portTHREAD_OF( pxCurrentTCB );
+
+	prvMaskTick( SIG_BLOCK, NULL );
+	T0TCR = 0;
+
+	pthread_mutex_lock( &xRunMutex );
+	xSchedulerRunning = pdFALSE;
+	pxRunningThread = NULL;
+	pthread_cond_signal( &xSchedulerEnded );
+	pthread_mutex_unlock( &xRunMutex );
+
+	/* main() carries on from vTaskStartScheduler(), the task never runs again. */
+	prvWaitForTurn( pxThread );
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+	sigset_t xOldMask;
+
+	#if ( portSIM_KERNEL_TIMING == 1 )
+	{
+		ullLastYield = ullPortSimCycleCount();
+	}
+	#endif
+
+	prvMaskTick( SIG_BLOCK, &xOldMask );
+	prvSwitchThreads();
+	prvRestoreMask( &xOldMask );
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+	prvMaskTick( SIG_BLOCK, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+	prvMaskTick( SIG_UNBLOCK, NULL );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortSetInterruptMask( void )
+{
+	sigset_t xOldMask;
+
+	prvMaskTick( SIG_BLOCK, &xOldMask );
+
+	return ( UBaseType_t ) sigismember( &xOldMask, SIGALRM );
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t uxMask )
+{
+	if( uxMask == 0 )
+	{
+		prvMaskTick( SIG_UNBLOCK, NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	if( uxCriticalNesting == 0 )
+	{
+		prvMaskTick( SIG_BLOCK, NULL );
+	}
+
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	if( uxCriticalNesting > 0 )
+	{
+		uxCriticalNesting--;
+
+		if( uxCriticalNesting == 0 )
+		{
+			prvMaskTick( SIG_UNBLOCK, NULL );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortSimStep( uint32_t ulCycles )
+{
+	prvStep( ( uint64_t ) ulCycles );
+}
+/*-----------------------------------------------------------*/
+
+void vPortSimWaitForInterrupt( void )
+{
+	const uint64_t ullCycles = prvCyclesToNextEvent();
+
+	/* On the target nothing would ever wake the processor up. */
+	configASSERT( ullCycles != portSIM_NO_EVENT );
+
+	prvAdvanceTimers( ullCycles );
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TICKLESS_IDLE != 0 )
+
+	/* Tickless idle, for a program that does not provide its own.  Called by
+	the idle task with the scheduler suspended.  No other task can run until
+	the next release, so the clock runs with the tick stopped to one cycle
+	before the tick that releases the task due, the ticks skipped are stepped
+	over, and that last tick is left to the tick interrupt. */
+	void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+	{
+		sigset_t xOldMask;
+
+		prvMaskTick( SIG_BLOCK, &xOldMask );
+
+		if( ( eTaskConfirmSleepModeStatus() != eAbortSleep ) && ( ( T0IR & portSIM_MR0_INTERRUPT ) == 0UL ) )
+		{
+			if( xExpectedIdleTime > portSIM_MAX_SUPPRESSED_TICKS )
+			{
+				xExpectedIdleTime = portSIM_MAX_SUPPRESSED_TICKS;
+			}
+
+			T0TCR &= ~portSIM_TIMER_ENABLE;
+			prvStep( ( uint64_t ) ( ( uint32_t ) T0MR0 - ( uint32_t ) T0TC ) + ( ( uint64_t ) ( xExpectedIdleTime - 1U ) * ( uint32_t ) T0MR0 ) - 1U );
+			vTaskStepTick( xExpectedIdleTime - 1U );
+			T0TC = T0MR0 - 1UL;
+			T0TCR |= portSIM_TIMER_ENABLE;
+		}
+
+		prvRestoreMask( &xOldMask );
+	}
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*-----------------------------------------------------------*/
+
+#if ( portSIM_KERNEL_TIMING == 1 )
+
+	/* Host cycle counter, the time stamp counter where there is one. */
+	uint64_t ullPortSimCycleCount( void )
+	{
+		#if defined( __x86_64__ ) || defined( __i386__ )
+		{
+			return __builtin_ia32_rdtsc();
+		}
+		#else
+		{
+			struct timespec xNow;
+
+			clock_gettime( CLOCK_MONOTONIC, &xNow );
+			return ( ( uint64_t ) xNow.tv_sec * 1000000000ULL ) + ( uint64_t ) xNow.tv_nsec;
+		}
+		#endif
+	}
+	/*-----------------------------------------------------------*/
+
+	uint64_t ullPortSimLastYield( void )
+	{
+		return ullLastYield;
+	}
+
+#endif /* portSIM_KERNEL_TIMING */
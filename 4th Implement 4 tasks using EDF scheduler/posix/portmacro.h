@@ -0,0 +1,132 @@
+/*
+ * E.C. : Host simulator port, lets the EDF kernel and the application of this
+ * folder run as a Linux process.  See port.c.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*-----------------------------------------------------------
+ * Port specific definitions.
+ *
+ * The settings in this file configure FreeRTOS correctly for the
+ * given hardware and compiler.
+ *
+ * These settings should not be altered.
+ *-----------------------------------------------------------
+ */
+
+/* Type definitions. */
+#define portCHAR		char
+#define portFLOAT		float
+#define portDOUBLE		double
+#define portLONG		long
+#define portSHORT		short
+#define portSTACK_TYPE	uintptr_t
+#define portBASE_TYPE	long
+#define portPOINTER_SIZE_TYPE	uintptr_t
+
+typedef portSTACK_TYPE StackType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+
+/* The tick count is kept 32 bits wide as on the LPC2129, so it overflows at the
+same count as on the target. */
+#if( configUSE_16_BIT_TICKS == 1 )
+	typedef uint16_t TickType_t;
+	#define portMAX_DELAY ( TickType_t ) 0xffff
+#else
+	typedef uint32_t TickType_t;
+	#define portMAX_DELAY ( TickType_t ) 0xffffffffUL
+#endif
+/*-----------------------------------------------------------*/
+
+/* Architecture specifics. */
+#define portSTACK_GROWTH			( -1 )
+#define portTICK_PERIOD_MS			( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+#define portBYTE_ALIGNMENT			8
+#define portNOP()
+
+/* Simulated time.  Task code calls vPortSimStep() for the PCLK cycles its work
+takes on the target, and vPortSimWaitForInterrupt() where the target sleeps
+until the next interrupt, as the idle task does on each turn of its loop. */
+extern void vPortSimStep( uint32_t ulCycles );
+extern void vPortSimWaitForInterrupt( void );
+#define portIDLE_TASK_STEP()	vPortSimWaitForInterrupt()
+/*-----------------------------------------------------------*/
+
+/* Scheduler utilities.  Interrupts are the tick signal, masked per thread. */
+extern void vPortYield( void );
+extern void vPortEnterCritical( void );
+extern void vPortExitCritical( void );
+extern void vPortDisableInterrupts( void );
+extern void vPortEnableInterrupts( void );
+extern UBaseType_t uxPortSetInterruptMask( void );
+extern void vPortClearInterruptMask( UBaseType_t uxMask );
+
+#define portYIELD()									vPortYield()
+#define portEND_SWITCHING_ISR( xSwitchRequired )	do { if( ( xSwitchRequired ) != pdFALSE ) { vPortYield(); } } while( 0 )
+#define portYIELD_FROM_ISR( x )						portEND_SWITCHING_ISR( x )
+
+#define portDISABLE_INTERRUPTS()					vPortDisableInterrupts()
+#define portENABLE_INTERRUPTS()						vPortEnableInterrupts()
+#define portSET_INTERRUPT_MASK_FROM_ISR()			uxPortSetInterruptMask()
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR( x )		vPortClearInterruptMask( x )
+#define portENTER_CRITICAL()						vPortEnterCritical()
+#define portEXIT_CRITICAL()							vPortExitCritical()
+/*-----------------------------------------------------------*/
+
+/* Every task runs on a thread of its own, which has to be stopped before the
+memory of the task is freed. */
+extern void vPortCleanUpTCB( void * pxTCB );
+#define portCLEAN_UP_TCB( pxTCB )	vPortCleanUpTCB( pxTCB )
+/*-----------------------------------------------------------*/
+
+/* Tickless idle, unless the application provides its own.  Nothing else runs
+while the idle task sleeps, so the clock runs on to the next release at once. */
+#ifndef portSUPPRESS_TICKS_AND_SLEEP
+	extern void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+	#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )	vPortSuppressTicksAndSleep( xExpectedIdleTime )
+#endif
+/*-----------------------------------------------------------*/
+
+/* Kernel timing for the benchmarks.  With portSIM_KERNEL_TIMING set to 1 the
+port times the kernel calls it makes and reports each one to
+vPortSimKernelTiming(), which the application provides.  The yield made by a
+task is time stamped too, so the time a blocking call takes to get to it can be
+measured. */
+#ifndef portSIM_KERNEL_TIMING
+	#define portSIM_KERNEL_TIMING	0
+#endif
+
+#if ( portSIM_KERNEL_TIMING == 1 )
+	typedef enum
+	{
+		eSimIncrementTick = 0,		/* xTaskIncrementTick() from the tick. */
+		eSimSwitchContext			/* vTaskSwitchContext() from the tick or a yield. */
+	} eSimKernelPath;
+
+	extern uint64_t ullPortSimCycleCount( void );
+	extern uint64_t ullPortSimLastYield( void );
+	extern void vPortSimKernelTiming( eSimKernelPath ePath, uint64_t ullCycles );
+#endif
+/*-----------------------------------------------------------*/
+
+/* Task function macros as described on the FreeRTOS.org WEB site. */
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters ) void vFunction( void *pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters ) void vFunction( void *pvParameters )
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PORTMACRO_H */
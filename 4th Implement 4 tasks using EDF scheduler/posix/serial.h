@@ -0,0 +1,13 @@
+/*
+ * E.C. : Host stand-in for the UART driver of the Keil project.  Characters
+ * sent to the UART go to the standard output of the simulator.
+ */
+
+#ifndef SERIAL_COMMS_H
+#define SERIAL_COMMS_H
+
+void xSerialPortInitMinimal( unsigned long ulWantedBaud );
+signed char xSerialPutChar( signed char cOutChar );
+void vSerialPutString( const signed char * const pcString, unsigned short usStringLength );
+
+#endif
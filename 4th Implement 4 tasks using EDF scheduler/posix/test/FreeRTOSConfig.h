@@ -0,0 +1,133 @@
+/*
+ * E.C. : Configuration of the scheduler tests, see edf_test.h.
+ *
+ * The kernel is built with the configuration of the application, changed only
+ * where the tests need it.  The variant under test comes from the compiler
+ * command line, as set by run_tests.sh:
+ *     -DtestREADY_QUEUE=0, 1 or 2	the sorted list, the binary heap or the
+ *								deadline buckets
+ *     -DtestWHEEL_SLOTS=0			sorted delayed lists instead of the timing
+ *								wheel
+ *     -DtestINITIAL_TICK_COUNT=n	start the tick count at n, to run a test
+ *								across an overflow of the tick count
+ *     -DtestMISS_POLICY=1 or 2		skip the next job after a deadline miss, or
+ *								abort the late job
+ *     -DtestBUDGET_POLICY=0 or 1	enforce the budget of the jobs, moving a job
+ *								that runs out of it to the background or
+ *								deferring it to the next release
+ *     -DtestSERVERS=1				constant bandwidth servers
+ *     -DtestADMISSION=1			admission control
+ *     -DtestSRP=1					Stack Resource Policy
+ *     -DtestJOB_CARRIERS=n			n shared stacks for run-to-completion jobs
+ */
+
+#ifndef TEST_FREERTOS_CONFIG_H
+#define TEST_FREERTOS_CONFIG_H
+
+#include "../../FreeRTOSConfig.h"
+
+#ifndef testREADY_QUEUE
+	#define testREADY_QUEUE			1
+#endif
+
+#ifndef testWHEEL_SLOTS
+	#define testWHEEL_SLOTS			128
+#endif
+
+#ifndef testINITIAL_TICK_COUNT
+	#define testINITIAL_TICK_COUNT	0
+#endif
+
+#ifndef testMISS_POLICY
+	#define testMISS_POLICY			0
+#endif
+
+#ifndef testSERVERS
+	#define testSERVERS				0
+#endif
+
+#ifndef testADMISSION
+	#define testADMISSION			0
+#endif
+
+#ifndef testSRP
+	#define testSRP					0
+#endif
+
+#ifndef testJOB_CARRIERS
+	#define testJOB_CARRIERS		0
+#endif
+
+#ifdef testBUDGET_POLICY
+	#undef configEDF_BUDGET_ENFORCEMENT
+	#define configEDF_BUDGET_ENFORCEMENT	1
+	#undef configEDF_BUDGET_POLICY
+	#define configEDF_BUDGET_POLICY		testBUDGET_POLICY
+#endif
+
+#undef configEDF_READY_QUEUE
+#define configEDF_READY_QUEUE		testREADY_QUEUE
+
+#undef configEDF_DELAYED_WHEEL_SLOTS
+#define configEDF_DELAYED_WHEEL_SLOTS	testWHEEL_SLOTS
+
+#define configINITIAL_TICK_COUNT	( ( TickType_t ) testINITIAL_TICK_COUNT )
+
+#undef configEDF_DEADLINE_MISS_POLICY
+#define configEDF_DEADLINE_MISS_POLICY	testMISS_POLICY
+
+#undef configUSE_EDF_SERVERS
+#define configUSE_EDF_SERVERS		testSERVERS
+
+#undef configEDF_ADMISSION_CONTROL
+#define configEDF_ADMISSION_CONTROL	testADMISSION
+
+#undef configUSE_EDF_SRP
+#define configUSE_EDF_SRP			testSRP
+
+#undef configEDF_JOB_CARRIERS
+#define configEDF_JOB_CARRIERS		testJOB_CARRIERS
+
+/* Servers, and the tasks of the admission tests, are created on the heap. */
+#undef configSUPPORT_DYNAMIC_ALLOCATION
+#define configSUPPORT_DYNAMIC_ALLOCATION	1
+#define configTOTAL_HEAP_SIZE		( ( size_t ) 64 * 1024 )
+
+/* The mutexes of queue.c inherit deadlines through the kernel. */
+#undef configUSE_MUTEXES
+#define configUSE_MUTEXES			1
+
+/* Every miss is counted by edf_test.c. */
+#undef configUSE_DEADLINE_MISS_HOOK
+#define configUSE_DEADLINE_MISS_HOOK	1
+
+/* Every job that runs out of its budget is counted by edf_test.c. */
+extern void vTestBudgetExhausted( void );
+#define traceTASK_BUDGET_EXHAUSTED( pxTCB )	vTestBudgetExhausted()
+
+/* So is a stack overflow, and the high water marks can be checked. */
+#define configCHECK_FOR_STACK_OVERFLOW			2
+#define INCLUDE_uxTaskGetStackHighWaterMark		1
+
+/* A failed assertion in the kernel fails the test. */
+extern void vTestAssertFailed( const char * pcFile, int iLine );
+#define configASSERT( x )			if( ( x ) == 0 ) vTestAssertFailed( __FILE__, __LINE__ )
+
+/* vApplicationSleep() is in main.c, which the tests do not link, so the
+tickless idle of the port is used. */
+#undef portSUPPRESS_TICKS_AND_SLEEP
+
+/* Only the kernel is tested, the trace of the application is left out. */
+#undef traceTASK_CREATE
+#undef traceTASK_RELEASED
+#undef traceTASK_BLOCKED
+#undef traceTASK_UNBLOCKED
+#undef traceTASK_SWITCHED_IN
+#undef traceTASK_SWITCHED_OUT
+
+/* Every context switch is counted by edf_test.c, even one that switches the
+same task back in. */
+extern void vTestSwitchedOut( void );
+#define traceTASK_SWITCHED_OUT()	vTestSwitchedOut()
+
+#endif /* TEST_FREERTOS_CONFIG_H */
@@ -0,0 +1,186 @@
+/*
+ * E.C. : Support shared by the scheduler tests, see edf_test.h.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "lpc21xx.h"
+
+#include "edf_test.h"
+
+#define testMAX_EVENTS			( 64 )
+#define testEVENT_LENGTH		( 24 )
+
+/* Timer 1 as set up by main.c. */
+#define testTIMER1_PRESCALE		( ( unsigned long ) 999 )
+
+static char pcEvents[ testMAX_EVENTS ][ testEVENT_LENGTH ];
+static UBaseType_t uxEvents = 0;
+static char pcLog[ testMAX_EVENTS * testEVENT_LENGTH ];
+
+static StaticTask_t xTaskBuffers[ testMAX_TASKS ];
+static StackType_t xStacks[ testMAX_TASKS ][ testSTACK_DEPTH ];
+static UBaseType_t uxTasks = 0;
+
+static StaticTask_t xIdleTaskBuffer;
+static StackType_t xIdleStack[ configMINIMAL_STACK_SIZE ];
+
+volatile UBaseType_t uxTestMisses = 0;
+volatile TickType_t xTestLastLateness = 0;
+volatile UBaseType_t uxTestExhausted = 0;
+volatile UBaseType_t uxTestSwitches = 0;
+volatile BaseType_t xTestExpectAssert = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+TaskHandle_t xTestCreate( TaskFunction_t pxTaskCode,
+						  const char * const pcName,
+						  TickType_t xPeriod,
+						  TickType_t xRelativeDeadline,
+						  TickType_t xOffset,
+						  configRUN_TIME_COUNTER_TYPE ulBudget )
+{
+	TaskHandle_t xTask = NULL;
+
+	testCHECK( uxTasks < testMAX_TASKS );
+	testCHECK( xTaskPeriodicCreateStatic( pxTaskCode, pcName, testSTACK_DEPTH, NULL, 1, xStacks[ uxTasks ], &( xTaskBuffers[ uxTasks ] ), &xTask,
+										  xPeriod, xRelativeDeadline, xOffset, 0, ulBudget ) == pdPASS );
+	uxTasks++;
+
+	return xTask;
+}
+
+void vTestStart( void )
+{
+	/* The run time counter, as in main.c. */
+	T1PR = testTIMER1_PRESCALE;
+	T1TCR |= 0x1;
+
+	vTaskStartScheduler();
+
+	testCHECK( pdFALSE );
+}
+
+TickType_t xTestNow( void )
+{
+	return xTaskGetTickCount() - configINITIAL_TICK_COUNT;
+}
+
+/* The ticks are taken as execution time: the task can be switched out in the
+middle and runs on from there when it is selected again. */
+void vTestRun( TickType_t xTicks )
+{
+	vPortSimStep( ( uint32_t ) xTicks * testCYCLES_PER_TICK );
+}
+
+void vTestLog( const char * pcEvent )
+{
+	taskENTER_CRITICAL();
+	{
+		testCHECK( uxEvents < testMAX_EVENTS );
+		snprintf( pcEvents[ uxEvents ], testEVENT_LENGTH, "%s@%u", pcEvent, ( unsigned ) xTestNow() );
+		uxEvents++;
+	}
+	taskEXIT_CRITICAL();
+}
+
+/* pcExpected is the log as the events written one after the other, separated
+by single spaces. */
+void vTestCheckLog( const char * pcExpected )
+{
+	UBaseType_t uxEvent;
+
+	pcLog[ 0 ] = '\0';
+
+	for( uxEvent = 0; uxEvent < uxEvents; uxEvent++ )
+	{
+		if( uxEvent != 0 )
+		{
+			strcat( pcLog, " " );
+		}
+
+		strcat( pcLog, pcEvents[ uxEvent ] );
+	}
+
+	if( strcmp( pcLog, pcExpected ) != 0 )
+	{
+		fprintf( stderr, "expected: %s\n     got: %s\n", pcExpected, pcLog );
+		_exit( 1 );
+	}
+}
+
+void vTestFail( const char * pcFile, int iLine, const char * pcWhat )
+{
+	portDISABLE_INTERRUPTS();
+	fprintf( stderr, "%s:%d: check failed: %s\n", pcFile, iLine, pcWhat );
+	_exit( 1 );
+}
+
+void vTestAssertFailed( const char * pcFile, int iLine )
+{
+	portDISABLE_INTERRUPTS();
+
+	if( xTestExpectAssert != pdFALSE )
+	{
+		_exit( 0 );
+	}
+
+	fprintf( stderr, "%s:%d: assertion failed\n", pcFile, iLine );
+	_exit( 1 );
+}
+
+void vTestBudgetExhausted( void )
+{
+	uxTestExhausted++;
+}
+
+void vTestSwitchedOut( void )
+{
+	uxTestSwitches++;
+}
+
+/*-----------------------------------------------------------*/
+
+void vApplicationGetIdleTaskMemory( StaticTask_t ** ppxIdleTaskTCBBuffer, StackType_t ** ppxIdleTaskStackBuffer, uint32_t * pulIdleTaskStackSize )
+{
+	*ppxIdleTaskTCBBuffer = &xIdleTaskBuffer;
+	*ppxIdleTaskStackBuffer = xIdleStack;
+	*pulIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+
+void vApplicationDeadlineMissHook( TaskHandle_t xTask, TickType_t xLateness )
+{
+	( void ) xTask;
+
+	uxTestMisses++;
+	xTestLastLateness = xLateness;
+}
+
+#if ( configCHECK_FOR_STACK_OVERFLOW > 0 )
+
+	void vApplicationStackOverflowHook( TaskHandle_t xTask, char * pcTaskName )
+	{
+		( void ) xTask;
+
+		portDISABLE_INTERRUPTS();
+		fprintf( stderr, "stack overflow in %s\n", pcTaskName );
+		_exit( 1 );
+	}
+
+#endif
+
+/* Ends the test.  The tasks make no library calls outside a critical section,
+so the checks can be made from the tick. */
+void vApplicationTickHook( void )
+{
+	if( xTestNow() >= xTestRunTicks )
+	{
+		vTestFinish();
+		_exit( 0 );
+	}
+}
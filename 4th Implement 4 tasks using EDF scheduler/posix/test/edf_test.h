@@ -0,0 +1,70 @@
+/*
+ * E.C. : Support shared by the scheduler tests, run on the host simulator of
+ * posix/.
+ *
+ * A test creates its tasks, then calls vTestStart().  The tasks take simulated
+ * time with vTestRun() and note what they do with vTestLog(), each event
+ * stamped with the ticks since the start.  The schedule depends only on the
+ * test, whatever the speed of the host, so once xTestRunTicks ticks have
+ * passed the tick hook calls vTestFinish() of the test, which checks the log
+ * and the counters against what the scheduler must have done.
+ *
+ * A test passes when it exits with 0.  A failed check, a failed assertion in
+ * the kernel or a stack overflow stops it with 1 and a message naming the
+ * line.  run_tests.sh builds and runs every test.
+ */
+
+#ifndef EDF_TEST_H
+#define EDF_TEST_H
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Tasks a test can create with xTestCreate(), and the words of stack of each.
+The stack only holds the thread of the port, see posix/port.c. */
+#define testMAX_TASKS			( 8 )
+#define testSTACK_DEPTH			( configMINIMAL_STACK_SIZE )
+
+#define testCYCLES_PER_TICK		( ( uint32_t ) ( configCPU_CLOCK_HZ / configTICK_RATE_HZ ) )
+
+/* Counts of Timer 1, the run time counter, in a tick, to give a budget in
+ticks.  main.c runs Timer 1 at PCLK / 1000, and so does vTestStart(). */
+#define testRUN_TIME_PER_TICK	( testCYCLES_PER_TICK / 1000UL )
+
+/* Stops the test with a failure if x is false. */
+#define testCHECK( x )			if( ( x ) == 0 ) vTestFail( __FILE__, __LINE__, #x )
+
+/* Given by each test: how long it runs, and the checks made at the end. */
+extern const TickType_t xTestRunTicks;
+extern void vTestFinish( void );
+
+/* Deadline misses reported to vApplicationDeadlineMissHook(), and the lateness
+of the last one. */
+extern volatile UBaseType_t uxTestMisses;
+extern volatile TickType_t xTestLastLateness;
+
+/* Jobs that ran out of their budget. */
+extern volatile UBaseType_t uxTestExhausted;
+
+/* Context switches, counted whether or not another task is switched in. */
+extern volatile UBaseType_t uxTestSwitches;
+
+/* Set by a test that expects the next assertion in the kernel to fail, which
+then ends the test with a pass. */
+extern volatile BaseType_t xTestExpectAssert;
+
+TaskHandle_t xTestCreate( TaskFunction_t pxTaskCode,
+						  const char * const pcName,
+						  TickType_t xPeriod,
+						  TickType_t xRelativeDeadline,
+						  TickType_t xOffset,
+						  configRUN_TIME_COUNTER_TYPE ulBudget );
+void vTestStart( void );
+TickType_t xTestNow( void );
+void vTestRun( TickType_t xTicks );
+void vTestLog( const char * pcEvent );
+void vTestCheckLog( const char * pcExpected );
+void vTestFail( const char * pcFile, int iLine, const char * pcWhat );
+
+#endif /* EDF_TEST_H */
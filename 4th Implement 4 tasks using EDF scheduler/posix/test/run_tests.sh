@@ -0,0 +1,77 @@
+#!/bin/sh
+#
+# E.C. : Builds every scheduler test of this folder for each EDF ready queue,
+# with the sorted delayed lists and with the timing wheel, and runs it, see
+# edf_test.h.  Prints a line for each run, with the output of those that fail,
+# and exits with 1 if any failed.
+#
+#     FREERTOS=<FreeRTOS V10.4.6 source folder> posix/test/run_tests.sh [test ...]
+#
+# Run from the folder above posix.  With no test named, as test_<name>.c, every
+# test is run.  Set CC and CFLAGS to change the compiler.
+
+: "${FREERTOS:?set FREERTOS to the FreeRTOS source folder}"
+CC=${CC:-cc}
+CFLAGS=${CFLAGS:--O2}
+OUT=${OUT:-posix/test/out}
+SELECTED=${*:-all}
+FAILED=0
+
+mkdir -p "$OUT"
+
+# test, variant or "" for none, then the configuration of the variant
+run_test()
+{
+	TEST=$1
+	VARIANT=$2
+	shift 2
+
+	case " $SELECTED " in
+		*" all "*|*" $TEST "*) ;;
+		*) return ;;
+	esac
+
+	for QUEUE in 0 1 2
+	do
+		for WHEEL in 0 128
+		do
+			NAME="$TEST${VARIANT:+_$VARIANT}_queue${QUEUE}_wheel$WHEEL"
+
+			if $CC -std=gnu99 $CFLAGS -DconfigSIM_POSIX=1 \
+					-DtestREADY_QUEUE=$QUEUE -DtestWHEEL_SLOTS=$WHEEL "$@" \
+					-I posix/test -I posix -I . -I "$FREERTOS/include" \
+					"posix/test/test_$TEST.c" posix/test/edf_test.c tasks.c posix/port.c posix/peripherals.c \
+					"$FREERTOS/list.c" "$FREERTOS/queue.c" "$FREERTOS/portable/MemMang/heap_4.c" \
+					-lpthread -o "$OUT/$NAME" > "$OUT/$NAME.txt" 2>&1 &&
+				timeout 60 "$OUT/$NAME" >> "$OUT/$NAME.txt" 2>&1
+			then
+				echo "pass $NAME"
+			else
+				echo "FAIL $NAME"
+				sed -e 's/^/    /' "$OUT/$NAME.txt"
+				FAILED=1
+			fi
+		done
+	done
+}
+
+run_test ready_queue ""
+run_test ready_queue wrap -DtestINITIAL_TICK_COUNT=0xFFFFFFE0UL
+run_test delay_until ""
+run_test deadline_miss continue -DtestMISS_POLICY=0
+run_test deadline_miss skip_next -DtestMISS_POLICY=1
+run_test deadline_miss abort -DtestMISS_POLICY=2
+run_test budget unenforced
+run_test budget background -DtestBUDGET_POLICY=0
+run_test budget defer -DtestBUDGET_POLICY=1
+run_test server "" -DtestSERVERS=1
+run_test admission "" -DtestADMISSION=1
+run_test srp "" -DtestSRP=1
+run_test job_carriers "" -DtestJOB_CARRIERS=3
+run_test job_carriers block -DtestJOB_CARRIERS=3 -DtestJOB_BLOCKS=1
+run_test inherit ""
+run_test event_list ""
+run_test event_list wrap -DtestINITIAL_TICK_COUNT=0xFFFFFFF0UL
+run_test yield ""
+
+exit $FAILED
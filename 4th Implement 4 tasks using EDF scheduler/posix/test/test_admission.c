@@ -0,0 +1,129 @@
+/*
+ * E.C. : Admission control admits a task only if the task set stays
+ * schedulable, by its utilisation while every deadline is the period, and by
+ * Quick Processor-demand Analysis once a deadline is shorter.  A task that is
+ * deleted no longer counts.
+ *
+ * The tasks are created and deleted at run time by Ctl, which is not accounted
+ * for as it has no WCET.  The last set, with periods near the range of the
+ * tick count, does not fit the window of the deadline buckets, which refuse a
+ * relative deadline that fills the window instead.
+ */
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_test.h"
+
+/* As in tasks.c, until projdefs.h has it. */
+#ifndef errTASK_NOT_ADMITTED
+	#define errTASK_NOT_ADMITTED	( -6 )
+#endif
+
+#ifndef errTASK_DEADLINE_OUT_OF_RANGE
+	#define errTASK_DEADLINE_OUT_OF_RANGE	( -7 )
+#endif
+
+#define testSET_SIZE			( 4 )
+
+const TickType_t xTestRunTicks = 5;
+
+static TaskHandle_t xSet[ testSET_SIZE ];
+
+static void prvNop( void * pvParameters )
+{
+	for( ;; )
+	{
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static BaseType_t prvCreate( TickType_t xWCET,
+							 TickType_t xRelativeDeadline,
+							 TickType_t xPeriod,
+							 TaskHandle_t * pxTask )
+{
+	return xTaskPeriodicCreateEx( prvNop, "T", testSTACK_DEPTH, NULL, 1, pxTask, xPeriod, xRelativeDeadline, 0, xWCET, 0 );
+}
+
+static void prvDeleteSet( void )
+{
+	UBaseType_t uxTask;
+
+	for( uxTask = 0; uxTask < testSET_SIZE; uxTask++ )
+	{
+		if( xSet[ uxTask ] != NULL )
+		{
+			vTaskDelete( xSet[ uxTask ] );
+			xSet[ uxTask ] = NULL;
+		}
+	}
+}
+
+static void prvControl( void * pvParameters )
+{
+	/* Deadlines equal to the periods: the utilisation may reach 1, exactly. */
+	testCHECK( prvCreate( 4, 16, 16, &( xSet[ 0 ] ) ) == pdPASS );
+	testCHECK( prvCreate( 8, 32, 32, &( xSet[ 1 ] ) ) == pdPASS );
+	testCHECK( prvCreate( 16, 64, 64, &( xSet[ 2 ] ) ) == pdPASS );
+	testCHECK( prvCreate( 16, 64, 64, &( xSet[ 3 ] ) ) == pdPASS );
+	testCHECK( prvCreate( 1, 64, 64, NULL ) == errTASK_NOT_ADMITTED );
+
+	vTaskDelete( xSet[ 3 ] );
+	xSet[ 3 ] = NULL;
+	testCHECK( prvCreate( 15, 64, 64, &( xSet[ 3 ] ) ) == pdPASS );
+	prvDeleteSet();
+
+	/* Constrained deadlines: by 5 the demand is 2 + 3, and one more tick of
+	work due by 5 is too much, while due by 6 it fits. */
+	testCHECK( prvCreate( 2, 4, 100, &( xSet[ 0 ] ) ) == pdPASS );
+	testCHECK( prvCreate( 3, 5, 100, &( xSet[ 1 ] ) ) == pdPASS );
+	testCHECK( prvCreate( 1, 5, 100, NULL ) == errTASK_NOT_ADMITTED );
+	testCHECK( prvCreate( 1, 6, 100, &( xSet[ 2 ] ) ) == pdPASS );
+
+	/* A constrained set that loads the processor fully cannot be analysed. */
+	testCHECK( prvCreate( 94, 100, 100, NULL ) == errTASK_NOT_ADMITTED );
+	prvDeleteSet();
+
+	#if ( configEDF_READY_QUEUE == 2 )
+		{
+			/* 64 buckets of 4 ticks, the window of the application. */
+			testCHECK( prvCreate( 1, 256, 1000, NULL ) == errTASK_DEADLINE_OUT_OF_RANGE );
+			testCHECK( prvCreate( 1, 255, 1000, &( xSet[ 0 ] ) ) == pdPASS );
+			prvDeleteSet();
+		}
+	#else
+		{
+			/* The busy period and the demand of these sets overflow 32 bits
+			while they are computed.  With the first task the second would
+			leave 2000000000 + 1999999000 ticks of work due by 3000000000. */
+			testCHECK( prvCreate( 2000000000U, 2100000000U, 4000000000U, &( xSet[ 0 ] ) ) == pdPASS );
+			testCHECK( prvCreate( 1999999000U, 3000000000U, 4000000000U, NULL ) == errTASK_NOT_ADMITTED );
+			testCHECK( prvCreate( 1, 1, 1000000U, &( xSet[ 1 ] ) ) == pdPASS );
+			testCHECK( prvCreate( 7, 10, 13, NULL ) == errTASK_NOT_ADMITTED );
+			testCHECK( prvCreate( 1, 3, 1000, &( xSet[ 2 ] ) ) == pdPASS );
+			prvDeleteSet();
+		}
+	#endif
+
+	vTestLog( "done" );
+
+	for( ;; )
+	{
+		xTaskWaitForNextPeriod();
+	}
+}
+
+void vTestFinish( void )
+{
+	vTestCheckLog( "done@0" );
+}
+
+int main( void )
+{
+	xTestCreate( prvControl, "Ctl", 100, 100, 0, 0 );
+	vTestStart();
+
+	return 1;
+}
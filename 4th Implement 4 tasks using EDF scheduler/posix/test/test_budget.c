@@ -0,0 +1,71 @@
+/*
+ * E.C. : A job that runs out of its budget is throttled by the policy, so it
+ * no longer holds off jobs with later deadlines.
+ *
+ *     task  period  deadline  offset  budget  run
+ *     Hog   40      40        0       3       5 for the first job, then 2
+ *     Lite  50      50        1       -       4
+ *
+ * Without enforcement the first job of Hog, with the earlier deadline, runs to
+ * completion before Lite starts.  Enforced, it runs out of its budget at 3 and
+ * Lite runs.  In the background the rest of the job runs as soon as nothing
+ * else is ready, deferred it runs as the job of the release at 40, which is
+ * then done.
+ */
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_test.h"
+
+const TickType_t xTestRunTicks = 60;
+
+static void prvHog( void * pvParameters )
+{
+	UBaseType_t uxJob;
+
+	for( uxJob = 0; ; uxJob++ )
+	{
+		vTestLog( "Hog+" );
+		vTestRun( ( uxJob == 0 ) ? 5 : 2 );
+		vTestLog( "Hog-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvLite( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "Lite+" );
+		vTestRun( 4 );
+		vTestLog( "Lite-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+void vTestFinish( void )
+{
+	#if ( configEDF_BUDGET_ENFORCEMENT == 0 )
+		vTestCheckLog( "Hog+@0 Hog-@5 Lite+@5 Lite-@9 Hog+@40 Hog-@42 Lite+@51 Lite-@55" );
+		testCHECK( uxTestExhausted == 0 );
+	#elif ( configEDF_BUDGET_POLICY == 0 )
+		vTestCheckLog( "Hog+@0 Lite+@3 Lite-@7 Hog-@9 Hog+@40 Hog-@42 Lite+@51 Lite-@55" );
+		testCHECK( uxTestExhausted == 1 );
+	#else
+		vTestCheckLog( "Hog+@0 Lite+@3 Lite-@7 Hog-@42 Lite+@51 Lite-@55" );
+		testCHECK( uxTestExhausted == 1 );
+	#endif
+
+	testCHECK( uxTestMisses == 0 );
+}
+
+int main( void )
+{
+	xTestCreate( prvHog, "Hog", 40, 40, 0, 3 * testRUN_TIME_PER_TICK );
+	xTestCreate( prvLite, "Lite", 50, 50, 1, 0 );
+	vTestStart();
+
+	return 1;
+}
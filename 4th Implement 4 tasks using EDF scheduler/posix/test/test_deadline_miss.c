@@ -0,0 +1,76 @@
+/*
+ * E.C. : A job that runs past its deadline is caught by the tick as it misses
+ * it, and the policy decides what happens to the next job.
+ *
+ * H has a period and a deadline of 10 ticks and its jobs run for 2 ticks, but
+ * the one released at 10 runs for 13 and misses its deadline at 20.  With the
+ * continue policy the job released at 20 starts as soon as it completes, at
+ * 23, with the deadline of its release, 30.  With the skip next policy that
+ * job is dropped and H waits for the release at 30.  With the abort policy the
+ * late job is taken off the processor at 20, and what is left of it runs as
+ * the job released at 30.
+ */
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_test.h"
+
+const TickType_t xTestRunTicks = 45;
+
+static TaskHandle_t xTaskH = NULL;
+
+static void prvTaskH( void * pvParameters )
+{
+	UBaseType_t uxJob;
+
+	for( uxJob = 0; ; uxJob++ )
+	{
+		vTestLog( "H+" );
+		vTestRun( ( uxJob == 1 ) ? 13 : 2 );
+		vTestLog( "H-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+void vTestFinish( void )
+{
+	TaskStatus_t xStatus[ testMAX_TASKS + 1 ];
+	UBaseType_t uxTask, uxTasks;
+
+	#if ( configEDF_DEADLINE_MISS_POLICY == 2 )
+		vTestCheckLog( "H+@0 H-@2 H+@10 H-@33 H+@40 H-@42" );
+	#elif ( configEDF_DEADLINE_MISS_POLICY == 1 )
+		vTestCheckLog( "H+@0 H-@2 H+@10 H-@23 H+@30 H-@32 H+@40 H-@42" );
+	#else
+		vTestCheckLog( "H+@0 H-@2 H+@10 H-@23 H+@23 H-@25 H+@30 H-@32 H+@40 H-@42" );
+	#endif
+
+	/* The hook is called once, at the deadline, and the lateness the task
+	keeps is how late the job completed, or when it was aborted. */
+	testCHECK( uxTestMisses == 1 );
+	testCHECK( xTestLastLateness == 0 );
+
+	uxTasks = uxTaskGetSystemState( xStatus, testMAX_TASKS + 1, NULL );
+
+	for( uxTask = 0; uxTask < uxTasks; uxTask++ )
+	{
+		if( xStatus[ uxTask ].xHandle == xTaskH )
+		{
+			testCHECK( xStatus[ uxTask ].uxDeadlineMisses == 1 );
+			testCHECK( xStatus[ uxTask ].xMaxLateness == ( ( configEDF_DEADLINE_MISS_POLICY == 2 ) ? 0 : 3 ) );
+			return;
+		}
+	}
+
+	testCHECK( pdFALSE );
+}
+
+int main( void )
+{
+	xTaskH = xTestCreate( prvTaskH, "H", 10, 10, 0, 0 );
+	vTestStart();
+
+	return 1;
+}
@@ -0,0 +1,58 @@
+/*
+ * E.C. : A periodic task that waits with vTaskDelayUntil() completes its job
+ * there, and its next job is released at the time to wake, by a deadline a
+ * relative deadline after it.
+ *
+ *     task  period  deadline  offset  run
+ *     A     20      20        0       2, waits with vTaskDelayUntil()
+ *     B     50      10        41      3
+ *
+ * The job of A released at 40 is due at 60, so B, due at 51, preempts it.
+ */
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_test.h"
+
+const TickType_t xTestRunTicks = 50;
+
+static void prvTaskA( void * pvParameters )
+{
+	TickType_t xLastWakeTime = xTaskGetTickCount();
+
+	for( ;; )
+	{
+		vTestLog( "A+" );
+		vTestRun( 2 );
+		vTestLog( "A-" );
+		vTaskDelayUntil( &xLastWakeTime, 20 );
+	}
+}
+
+static void prvTaskB( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "B+" );
+		vTestRun( 3 );
+		vTestLog( "B-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+void vTestFinish( void )
+{
+	vTestCheckLog( "A+@0 A-@2 A+@20 A-@22 A+@40 B+@41 B-@44 A-@45" );
+	testCHECK( uxTestMisses == 0 );
+}
+
+int main( void )
+{
+	xTestCreate( prvTaskA, "A", 20, 20, 0, 0 );
+	xTestCreate( prvTaskB, "B", 50, 10, 41, 0 );
+	vTestStart();
+
+	return 1;
+}
@@ -0,0 +1,157 @@
+/*
+ * E.C. : Tasks waiting on an event list are taken from it by deadline, not in
+ * the order they blocked in.  The mutex and the queue are those of queue.c.
+ *
+ *     task  period  deadline  offset  run
+ *     L     100     100       0       12 holding the mutex
+ *     B     100     40        2       1 holding the mutex
+ *     A     100     10        4       1 holding the mutex
+ *
+ * B blocks on the mutex before A, but A has the earlier deadline and gets it
+ * first when L gives it at 12.
+ *
+ *     R     200     60        20      1, after receiving from the queue
+ *     E     200     30        21      1, after receiving from the queue
+ *     S     200     100       22      1, after sending 1 then 2
+ *     V     200     100       30      1, after receiving from the queue
+ *     T     200     10        31      1, after sending 3
+ *
+ * R waits on the empty queue before E, but E has the earlier deadline and
+ * receives the 1 that S sends at 22, and R the 2.  V, woken by the send of T,
+ * has a later deadline than T, so the send does not switch T out.
+ *
+ * run_tests.sh also runs it from just before an overflow of the tick count,
+ * where the deadline of B wraps round to a small value and must still come
+ * after the one of A.
+ */
+
+#include <stdio.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+
+#include "edf_test.h"
+
+const TickType_t xTestRunTicks = 40;
+
+static StaticSemaphore_t xMutexBuffer;
+static SemaphoreHandle_t xMutex = NULL;
+
+static StaticQueue_t xQueueBuffer;
+static uint8_t ucQueueStorage[ sizeof( uint32_t ) ];
+static QueueHandle_t xQueue = NULL;
+
+static void prvTaskL( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "L+" );
+		testCHECK( xSemaphoreTake( xMutex, portMAX_DELAY ) == pdPASS );
+		vTestRun( 12 );
+		vTestLog( "Lgive" );
+		testCHECK( xSemaphoreGive( xMutex ) == pdPASS );
+		vTestLog( "L-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskA( void * pvParameters )
+{
+	for( ;; )
+	{
+		testCHECK( xSemaphoreTake( xMutex, portMAX_DELAY ) == pdPASS );
+		vTestLog( "Agot" );
+		vTestRun( 1 );
+		testCHECK( xSemaphoreGive( xMutex ) == pdPASS );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskB( void * pvParameters )
+{
+	for( ;; )
+	{
+		testCHECK( xSemaphoreTake( xMutex, portMAX_DELAY ) == pdPASS );
+		vTestLog( "Bgot" );
+		vTestRun( 1 );
+		testCHECK( xSemaphoreGive( xMutex ) == pdPASS );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+/* R, E and V receive an item and log it, as "Rgot2" for R receiving 2. */
+static void prvReceiver( void * pvParameters )
+{
+	char pcEvent[ 8 ];
+	uint32_t ulItem;
+
+	for( ;; )
+	{
+		testCHECK( xQueueReceive( xQueue, &ulItem, portMAX_DELAY ) == pdPASS );
+		snprintf( pcEvent, sizeof( pcEvent ), "%cgot%u", pcTaskGetName( NULL )[ 0 ], ( unsigned ) ulItem );
+		vTestLog( pcEvent );
+		vTestRun( 1 );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskS( void * pvParameters )
+{
+	uint32_t ulItem;
+
+	for( ;; )
+	{
+		for( ulItem = 1; ulItem <= 2; ulItem++ )
+		{
+			testCHECK( xQueueSend( xQueue, &ulItem, portMAX_DELAY ) == pdPASS );
+		}
+
+		vTestRun( 1 );
+		vTestLog( "S-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskT( void * pvParameters )
+{
+	const uint32_t ulItem = 3;
+	UBaseType_t uxSwitches;
+
+	for( ;; )
+	{
+		uxSwitches = uxTestSwitches;
+		testCHECK( xQueueSend( xQueue, &ulItem, portMAX_DELAY ) == pdPASS );
+		testCHECK( uxTestSwitches == uxSwitches );
+		vTestRun( 1 );
+		vTestLog( "T-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+void vTestFinish( void )
+{
+	vTestCheckLog( "L+@0 Lgive@12 Agot@12 Bgot@13 L-@14 "
+				   "Egot1@22 Rgot2@23 S-@25 T-@32 Vgot3@32" );
+	testCHECK( uxTestMisses == 0 );
+}
+
+int main( void )
+{
+	xMutex = xSemaphoreCreateMutexStatic( &xMutexBuffer );
+	xQueue = xQueueCreateStatic( 1, sizeof( uint32_t ), ucQueueStorage, &xQueueBuffer );
+
+	xTestCreate( prvTaskL, "L", 100, 100, 0, 0 );
+	xTestCreate( prvTaskB, "B", 100, 40, 2, 0 );
+	xTestCreate( prvTaskA, "A", 100, 10, 4, 0 );
+	xTestCreate( prvReceiver, "R", 200, 60, 20, 0 );
+	xTestCreate( prvReceiver, "E", 200, 30, 21, 0 );
+	xTestCreate( prvTaskS, "S", 200, 100, 22, 0 );
+	xTestCreate( prvReceiver, "V", 200, 100, 30, 0 );
+	xTestCreate( prvTaskT, "T", 200, 10, 31, 0 );
+	vTestStart();
+
+	return 1;
+}
@@ -0,0 +1,136 @@
+/*
+ * E.C. : A task that blocks on a mutex lends its deadline to the holder, so a
+ * job with a deadline between the two cannot delay the holder, and with it the
+ * blocked task, for as long as it runs.  The mutexes are those of queue.c.
+ *
+ *     task  period  deadline  offset  run
+ *     L     100     100       0       8 holding mutex 1, then 2
+ *     M     100     30        2       5
+ *     H     100     10        4       1 holding mutex 1
+ *
+ * H blocks at 4 on the mutex held by L.  L runs on by the deadline of H ahead
+ * of M and gives the mutex at 10, where it goes back to its own deadline.
+ *
+ *     P     200     200       40      1 holding mutex 2, delay 6, 2, then 1
+ *     W     200     10        42      1, after waiting 3 for mutex 2
+ *     N     200     30        43      4
+ *
+ * W blocks at 42 on the mutex held by P, which is delayed, and times out at
+ * 45.  P keeps the deadline 52 it inherited from W until it gives the mutex,
+ * see vTaskPriorityDisinheritAfterTimeout(), so when it wakes at 47 it still
+ * preempts N, and only after giving the mutex at 49 does it run after N.
+ */
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+#include "edf_test.h"
+
+const TickType_t xTestRunTicks = 60;
+
+static StaticSemaphore_t xMutexBuffer1, xMutexBuffer2;
+static SemaphoreHandle_t xMutex1 = NULL, xMutex2 = NULL;
+
+static void prvTaskL( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "L+" );
+		testCHECK( xSemaphoreTake( xMutex1, portMAX_DELAY ) == pdPASS );
+		vTestRun( 8 );
+		vTestLog( "Lgive" );
+		testCHECK( xSemaphoreGive( xMutex1 ) == pdPASS );
+		vTestRun( 2 );
+		vTestLog( "L-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskM( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "M+" );
+		vTestRun( 5 );
+		vTestLog( "M-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskH( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "H+" );
+		testCHECK( xSemaphoreTake( xMutex1, portMAX_DELAY ) == pdPASS );
+		vTestLog( "Hgot" );
+		vTestRun( 1 );
+		testCHECK( xSemaphoreGive( xMutex1 ) == pdPASS );
+		vTestLog( "H-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskP( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "P+" );
+		testCHECK( xSemaphoreTake( xMutex2, portMAX_DELAY ) == pdPASS );
+		vTestRun( 1 );
+		vTaskDelay( 6 );
+		vTestLog( "Pwoke" );
+		vTestRun( 2 );
+		vTestLog( "Pgive" );
+		testCHECK( xSemaphoreGive( xMutex2 ) == pdPASS );
+		vTestRun( 1 );
+		vTestLog( "P-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskW( void * pvParameters )
+{
+	for( ;; )
+	{
+		testCHECK( xSemaphoreTake( xMutex2, 3 ) == pdFAIL );
+		vTestLog( "Wtimeout" );
+		vTestRun( 1 );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskN( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestRun( 4 );
+		vTestLog( "N-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+void vTestFinish( void )
+{
+	vTestCheckLog( "L+@0 M+@2 H+@4 Lgive@10 Hgot@10 H-@11 M-@14 L-@16 "
+				   "P+@40 Wtimeout@45 Pwoke@47 Pgive@49 N-@50 P-@51" );
+	testCHECK( uxTestMisses == 0 );
+}
+
+int main( void )
+{
+	xMutex1 = xSemaphoreCreateMutexStatic( &xMutexBuffer1 );
+	xMutex2 = xSemaphoreCreateMutexStatic( &xMutexBuffer2 );
+
+	xTestCreate( prvTaskL, "L", 100, 100, 0, 0 );
+	xTestCreate( prvTaskM, "M", 100, 30, 2, 0 );
+	xTestCreate( prvTaskH, "H", 100, 10, 4, 0 );
+	xTestCreate( prvTaskP, "P", 200, 200, 40, 0 );
+	xTestCreate( prvTaskW, "W", 200, 10, 42, 0 );
+	xTestCreate( prvTaskN, "N", 200, 30, 43, 0 );
+	vTestStart();
+
+	return 1;
+}
@@ -0,0 +1,119 @@
+/*
+ * E.C. : The jobs of a task created by xTaskPeriodicJobCreateStatic() run to
+ * completion on the shared stacks of the job carriers, one carrier for each
+ * job preempted at once, and the task has no stack of its own.
+ *
+ *     task  period  deadline  offset  run
+ *     C     100     50        0       8
+ *     B     40      30        1       5
+ *     A     20      10        3       2
+ *
+ * A preempts B which preempts C, so the three carriers are in use at 3.  Each
+ * carrier runs on a thread of the port, which tells them apart.
+ *
+ * Built with testJOB_BLOCKS a job of A blocks, which a job must never do as it
+ * would hold its carrier, and the kernel has to assert.
+ */
+
+#include <pthread.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_test.h"
+
+#ifndef testJOB_BLOCKS
+	#define testJOB_BLOCKS		0
+#endif
+
+const TickType_t xTestRunTicks = 60;
+
+static StaticTask_t xJobTaskBuffers[ 3 ];
+static TaskHandle_t xJobTasks[ 3 ];
+
+static pthread_t xCarriers[ configEDF_JOB_CARRIERS ];
+static UBaseType_t uxCarriers = 0;
+
+static void prvNoteCarrier( void )
+{
+	const pthread_t xSelf = pthread_self();
+	UBaseType_t uxCarrier;
+
+	taskENTER_CRITICAL();
+	{
+		for( uxCarrier = 0; ( uxCarrier < uxCarriers ) && ( pthread_equal( xCarriers[ uxCarrier ], xSelf ) == 0 ); uxCarrier++ )
+		{
+		}
+
+		if( uxCarrier == uxCarriers )
+		{
+			testCHECK( uxCarriers < configEDF_JOB_CARRIERS );
+			xCarriers[ uxCarriers++ ] = xSelf;
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+
+static void prvJobA( void * pvParameters )
+{
+	prvNoteCarrier();
+	vTestLog( "A+" );
+
+	#if ( testJOB_BLOCKS == 1 )
+		{
+			xTestExpectAssert = pdTRUE;
+			vTaskDelay( 1 );
+			testCHECK( pdFALSE );
+		}
+	#endif
+
+	vTestRun( 2 );
+	vTestLog( "A-" );
+}
+
+static void prvJobB( void * pvParameters )
+{
+	prvNoteCarrier();
+	vTestLog( "B+" );
+	vTestRun( 5 );
+	vTestLog( "B-" );
+}
+
+static void prvJobC( void * pvParameters )
+{
+	prvNoteCarrier();
+	vTestLog( "C+" );
+	vTestRun( 8 );
+	vTestLog( "C-" );
+}
+
+void vTestFinish( void )
+{
+	TaskStatus_t xStatus;
+	UBaseType_t uxTask;
+
+	testCHECK( testJOB_BLOCKS == 0 );
+
+	vTestCheckLog( "C+@0 B+@1 A+@3 A-@5 B-@8 C-@15 A+@23 A-@25 B+@41 A+@43 A-@45 B-@48" );
+	testCHECK( uxCarriers == 3 );
+
+	for( uxTask = 0; uxTask < 3; uxTask++ )
+	{
+		vTaskGetInfo( xJobTasks[ uxTask ], &xStatus, pdTRUE, eInvalid );
+		testCHECK( xStatus.uxDeadlineMisses == 0 );
+		testCHECK( xStatus.pxStackBase == NULL );
+		testCHECK( xStatus.usStackHighWaterMark == 0 );
+		testCHECK( uxTaskGetStackHighWaterMark( xJobTasks[ uxTask ] ) == 0 );
+	}
+}
+
+int main( void )
+{
+	xTaskPeriodicJobCreateStatic( prvJobC, "C", NULL, 1, &( xJobTaskBuffers[ 0 ] ), &( xJobTasks[ 0 ] ), 100, 50, 0, 0, 0 );
+	xTaskPeriodicJobCreateStatic( prvJobB, "B", NULL, 1, &( xJobTaskBuffers[ 1 ] ), &( xJobTasks[ 1 ] ), 40, 30, 1, 0, 0 );
+	xTaskPeriodicJobCreateStatic( prvJobA, "A", NULL, 1, &( xJobTaskBuffers[ 2 ] ), &( xJobTasks[ 2 ] ), 20, 10, 3, 0, 0 );
+	vTestStart();
+
+	return 1;
+}
@@ -0,0 +1,84 @@
+/*
+ * E.C. : The EDF ready queue runs the job with the earliest deadline, and a
+ * job released with an earlier deadline than the running one preempts it.
+ *
+ *     task  period  deadline  offset  run
+ *     C     100     100       0       8
+ *     B     40      40        1       5
+ *     A     20      20        3       2
+ *     E     50      50        9       1
+ *
+ * run_tests.sh also runs it from just before an overflow of the tick count,
+ * where the deadlines of the jobs released after it wrap round to small values
+ * and must still come after the earlier ones.
+ */
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_test.h"
+
+const TickType_t xTestRunTicks = 60;
+
+static void prvTaskA( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "A+" );
+		vTestRun( 2 );
+		vTestLog( "A-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskB( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "B+" );
+		vTestRun( 5 );
+		vTestLog( "B-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskC( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "C+" );
+		vTestRun( 8 );
+		vTestLog( "C-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskE( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "E+" );
+		vTestRun( 1 );
+		vTestLog( "E-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+void vTestFinish( void )
+{
+	vTestCheckLog( "C+@0 B+@1 A+@3 A-@5 B-@8 E+@9 E-@10 C-@16 "
+				   "A+@23 A-@25 B+@41 A+@43 A-@45 B-@48 E+@59" );
+	testCHECK( uxTestMisses == 0 );
+}
+
+int main( void )
+{
+	xTestCreate( prvTaskC, "C", 100, 100, 0, 0 );
+	xTestCreate( prvTaskB, "B", 40, 40, 1, 0 );
+	xTestCreate( prvTaskA, "A", 20, 20, 3, 0 );
+	xTestCreate( prvTaskE, "E", 50, 50, 9, 0 );
+	vTestStart();
+
+	return 1;
+}
@@ -0,0 +1,72 @@
+/*
+ * E.C. : A constant bandwidth server runs its aperiodic work by the deadline
+ * of the server, and never takes more than its bandwidth, even when the
+ * processor would be idle otherwise.
+ *
+ *     task  period  deadline  offset  run
+ *     Per   10      10        0       4
+ *     Src   100     100       6       0, gives Srv one event
+ *     Srv   server of 2 ticks every 10, each event takes it 5 ticks
+ *
+ * The event arrives at 6 and Srv runs by the deadline 16.  It uses up its
+ * budget at 8, so it waits until 16 for the refill, runs by 26 from there,
+ * uses it up again at 18 and ends the work at 27, by the deadline 36.
+ */
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_test.h"
+
+const TickType_t xTestRunTicks = 40;
+
+static TaskHandle_t xServer = NULL;
+
+static void prvPeriodic( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "Per+" );
+		vTestRun( 4 );
+		vTestLog( "Per-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvSource( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "ev" );
+		xTaskNotifyGive( xServer );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvServer( void * pvParameters )
+{
+	for( ;; )
+	{
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		vTestLog( "Srv+" );
+		vTestRun( 5 );
+		vTestLog( "Srv-" );
+	}
+}
+
+void vTestFinish( void )
+{
+	vTestCheckLog( "Per+@0 Per-@4 ev@6 Srv+@6 Per+@10 Per-@14 Per+@20 Per-@24 Srv-@27 Per+@30 Per-@34" );
+	testCHECK( uxTestMisses == 0 );
+}
+
+int main( void )
+{
+	xTestCreate( prvPeriodic, "Per", 10, 10, 0, 0 );
+	xTestCreate( prvSource, "Src", 100, 100, 6, 0 );
+	testCHECK( xTaskServerCreate( prvServer, "Srv", testSTACK_DEPTH, NULL, 1, &xServer, 2, 10 ) == pdPASS );
+	vTestStart();
+
+	return 1;
+}
@@ -0,0 +1,127 @@
+/*
+ * E.C. : Under the Stack Resource Policy a job starts only if its preemption
+ * level is above the system ceiling, whether it was released by the tick or
+ * woken by another task, so it never blocks on a resource once started.
+ *
+ *     task  period  deadline  offset  resource  run
+ *     L     100     100       0       R         12, 10 of them holding R
+ *     W     1000    20        0       R         1, once woken by L
+ *     H     50      20        2       R         1
+ *     M     100     30        3       -         3
+ *     X     100     10        4       -         1
+ *
+ * The ceiling of R is the level of the deadline 20.  While L holds it only X,
+ * with a shorter deadline, preempts L.  W, woken by L at 2 with the earlier
+ * deadline 20, and H and M all wait until L unlocks at 11.  Waking W does not
+ * switch L out, as W is held back rather than made ready.
+ */
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_test.h"
+
+#define testRESOURCE			( 0 )
+
+const TickType_t xTestRunTicks = 60;
+
+static TaskHandle_t xTaskW = NULL;
+
+static void prvTaskL( void * pvParameters )
+{
+	UBaseType_t uxSwitches;
+
+	for( ;; )
+	{
+		vTestLog( "L+" );
+		vTaskSRPLock( testRESOURCE );
+		vTestLog( "Llock" );
+		vTestRun( 2 );
+		vTestLog( "Lgive" );
+		uxSwitches = uxTestSwitches;
+		xTaskNotifyGive( xTaskW );
+		testCHECK( uxTestSwitches == uxSwitches );
+		vTestRun( 8 );
+		vTestLog( "Lunlock" );
+		vTaskSRPUnlock( testRESOURCE );
+		vTestRun( 2 );
+		vTestLog( "L-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskW( void * pvParameters )
+{
+	for( ;; )
+	{
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		vTestLog( "Wgot" );
+		vTaskSRPLock( testRESOURCE );
+		vTestRun( 1 );
+		vTaskSRPUnlock( testRESOURCE );
+		vTestLog( "W-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskH( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "H+" );
+		vTaskSRPLock( testRESOURCE );
+		vTestRun( 1 );
+		vTaskSRPUnlock( testRESOURCE );
+		vTestLog( "H-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskM( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "M+" );
+		vTestRun( 3 );
+		vTestLog( "M-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskX( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "X+" );
+		vTestRun( 1 );
+		vTestLog( "X-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+void vTestFinish( void )
+{
+	vTestCheckLog( "L+@0 Llock@0 Lgive@2 X+@4 X-@5 Lunlock@11 Wgot@11 W-@12 H+@12 H-@13 "
+				   "M+@13 M-@16 L-@18 H+@52 H-@53" );
+	testCHECK( uxTestMisses == 0 );
+}
+
+int main( void )
+{
+	TaskHandle_t xTaskL, xTaskH;
+
+	xTaskL = xTestCreate( prvTaskL, "L", 100, 100, 0, 0 );
+	xTaskW = xTestCreate( prvTaskW, "W", 1000, 20, 0, 0 );
+	xTaskH = xTestCreate( prvTaskH, "H", 50, 20, 2, 0 );
+	xTestCreate( prvTaskM, "M", 100, 30, 3, 0 );
+	xTestCreate( prvTaskX, "X", 100, 10, 4, 0 );
+
+	vTaskSRPUseResource( xTaskL, testRESOURCE );
+	vTaskSRPUseResource( xTaskW, testRESOURCE );
+	vTaskSRPUseResource( xTaskH, testRESOURCE );
+
+	vTestStart();
+
+	return 1;
+}
@@ -0,0 +1,88 @@
+/*
+ * E.C. : A task made ready by the running one preempts it at once if its
+ * deadline is earlier, and otherwise waits until the running job is done.
+ *
+ *     task   period  deadline  offset
+ *     Late   100     90        0       waits for a notification
+ *     Early  100     20        1       waits for a notification
+ *     S      100     15        2       suspends itself
+ *     P      100     50        5       notifies Early, resumes S, runs 2, then
+ *                                      notifies Late
+ *
+ * Early and S run as soon as P readies them, Late only once P is done.
+ */
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "edf_test.h"
+
+const TickType_t xTestRunTicks = 30;
+
+static TaskHandle_t xLate, xEarly, xSuspended;
+
+static void prvTaskLate( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "Late+" );
+		( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		vTestLog( "Lategot" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskEarly( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "Early+" );
+		( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		vTestLog( "Earlygot" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskS( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "S+" );
+		vTaskSuspend( NULL );
+		vTestLog( "Sgot" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+static void prvTaskP( void * pvParameters )
+{
+	for( ;; )
+	{
+		vTestLog( "P+" );
+		xTaskNotifyGive( xEarly );
+		vTaskResume( xSuspended );
+		vTestLog( "P1" );
+		vTestRun( 2 );
+		xTaskNotifyGive( xLate );
+		vTestLog( "P-" );
+		xTaskWaitForNextPeriod();
+	}
+}
+
+void vTestFinish( void )
+{
+	vTestCheckLog( "Late+@0 Early+@1 S+@2 P+@5 Earlygot@5 Sgot@5 P1@5 P-@7 Lategot@7" );
+	testCHECK( uxTestMisses == 0 );
+}
+
+int main( void )
+{
+	xLate = xTestCreate( prvTaskLate, "Late", 100, 90, 0, 0 );
+	xEarly = xTestCreate( prvTaskEarly, "Early", 100, 20, 1, 0 );
+	xSuspended = xTestCreate( prvTaskS, "S", 100, 15, 2, 0 );
+	xTestCreate( prvTaskP, "P", 100, 50, 5, 0 );
+	vTestStart();
+
+	return 1;
+}
@@ -115,6 +115,330 @@
     #define configIDLE_TASK_NAME    "IDLE"
 #endif
 
+/* E.C. : Called at the end of every turn of the idle task loop.  A simulator
+ * port, where time only passes as code says it does, lets the time run on to
+ * the next interrupt there.  Nothing to do on the target. */
+#ifndef portIDLE_TASK_STEP
+    #define portIDLE_TASK_STEP()
+#endif
+
+/* E.C. : Trace hooks for a job released by the tick, for the running task
+ * entering the Blocked state and for a task leaving it other than by the
+ * release of a job.  As with the hooks of FreeRTOS.h they expand to nothing
+ * unless FreeRTOSConfig.h defines them.  traceMOVED_TASK_TO_READY_STATE is
+ * left to its FreeRTOS meaning, it also fires for tasks that were already
+ * ready, so it cannot stand for one event. */
+#ifndef traceTASK_RELEASED
+    #define traceTASK_RELEASED( pxTCB )
+#endif
+
+#ifndef traceTASK_UNBLOCKED
+    #define traceTASK_UNBLOCKED( pxTCB )
+#endif
+
+#ifndef traceTASK_BLOCKED
+    #define traceTASK_BLOCKED( xTicksToWait )
+#endif
+
+#ifndef traceTASK_DEADLINE_MISSED
+    #define traceTASK_DEADLINE_MISSED( pxTCB, xLateness )
+#endif
+
+/* E.C. : Data structures that can back the EDF ready queue.  The sorted list
+ * keeps xReadyTasksListEDF itself in deadline order, which costs O(n) per
+ * insertion.  The binary heap indexes the ready tasks by absolute deadline so
+ * both insertion and selection cost O(log n).  The deadline buckets hash the
+ * absolute deadline into a ring of lists and find the earliest non-empty one
+ * through a two level bitmap, so insertion and selection take constant time
+ * regardless of the number of tasks. */
+#define tskEDF_READY_QUEUE_SORTED_LIST      0
+#define tskEDF_READY_QUEUE_BINARY_HEAP      1
+#define tskEDF_READY_QUEUE_DEADLINE_BUCKETS 2
+
+#ifndef configEDF_READY_QUEUE
+    #define configEDF_READY_QUEUE    tskEDF_READY_QUEUE_SORTED_LIST
+#endif
+
+/* E.C. : What becomes of a job found to have missed its deadline.  With
+ * CONTINUE it runs on with its deadline.  With SKIP_NEXT the task also skips
+ * the release that follows the late job, to catch up with its schedule.  With
+ * ABORT the job stops competing for the processor at the tick that finds the
+ * miss, and the task is blocked until its next release. */
+#define tskEDF_DEADLINE_MISS_CONTINUE     0
+#define tskEDF_DEADLINE_MISS_SKIP_NEXT    1
+#define tskEDF_DEADLINE_MISS_ABORT        2
+
+#ifndef configEDF_DEADLINE_MISS_POLICY
+    #define configEDF_DEADLINE_MISS_POLICY    tskEDF_DEADLINE_MISS_CONTINUE
+#endif
+
+#if ( ( configEDF_DEADLINE_MISS_POLICY != tskEDF_DEADLINE_MISS_CONTINUE ) && \
+      ( configEDF_DEADLINE_MISS_POLICY != tskEDF_DEADLINE_MISS_SKIP_NEXT ) &&  \
+      ( configEDF_DEADLINE_MISS_POLICY != tskEDF_DEADLINE_MISS_ABORT ) )
+    #error configEDF_DEADLINE_MISS_POLICY must be 0 to continue a late job, 1 to skip the next job or 2 to abort the job
+#endif
+
+#ifndef configUSE_DEADLINE_MISS_HOOK
+    #define configUSE_DEADLINE_MISS_HOOK    0
+#endif
+
+/* E.C. : Execution budgets.  A task created with a budget has the run time of
+ * each of its jobs charged at every switch out, in the units of the run time
+ * stats counter, and compared with the budget at every tick.  A job that uses
+ * up its budget is throttled.  With BACKGROUND it gives up its deadline and
+ * only runs once no job with a deadline is ready, sharing the processor with
+ * the idle task.  With DEFER the task is blocked until its next release. */
+#define tskEDF_BUDGET_BACKGROUND    0
+#define tskEDF_BUDGET_DEFER         1
+
+#ifndef configEDF_BUDGET_ENFORCEMENT
+    #define configEDF_BUDGET_ENFORCEMENT    0
+#endif
+
+#ifndef configEDF_BUDGET_POLICY
+    #define configEDF_BUDGET_POLICY    tskEDF_BUDGET_BACKGROUND
+#endif
+
+#if ( ( configEDF_BUDGET_ENFORCEMENT == 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+    #error configEDF_BUDGET_ENFORCEMENT needs configGENERATE_RUN_TIME_STATS to be set to 1
+#endif
+
+#ifndef traceTASK_BUDGET_EXHAUSTED
+    #define traceTASK_BUDGET_EXHAUSTED( pxTCB )
+#endif
+
+/* E.C. : Jobs can be blocked until the next release of their task by the
+ * ABORT miss policy and by the DEFER budget policy, and moved to the
+ * background by the BACKGROUND budget policy. */
+#define taskEDF_DEFER_JOBS                                                      \
+    ( ( configEDF_DEADLINE_MISS_POLICY == tskEDF_DEADLINE_MISS_ABORT ) ||       \
+      ( ( configEDF_BUDGET_ENFORCEMENT == 1 ) && ( configEDF_BUDGET_POLICY == tskEDF_BUDGET_DEFER ) ) )
+
+#define taskEDF_BACKGROUND_JOBS    ( ( configEDF_BUDGET_ENFORCEMENT == 1 ) && ( configEDF_BUDGET_POLICY == tskEDF_BUDGET_BACKGROUND ) )
+
+#if ( configEDF_BUDGET_ENFORCEMENT == 1 )
+    #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+        #define taskEDF_GET_RUN_TIME_COUNTER_VALUE( ulTime )    portALT_GET_RUN_TIME_COUNTER_VALUE( ulTime )
+    #else
+        #define taskEDF_GET_RUN_TIME_COUNTER_VALUE( ulTime )    ( ulTime ) = portGET_RUN_TIME_COUNTER_VALUE()
+    #endif
+#endif
+
+/* E.C. : Constant bandwidth servers.  A task created by xTaskServerCreate()
+ * is given a budget of Q ticks every T ticks.  It runs by the deadline of its
+ * server, which is set afresh on an arrival, when the task becomes ready after
+ * blocking, only if the budget left could not be used up by the current
+ * deadline within the bandwidth Q / T.  The running server is charged a tick
+ * at a time, and a server that has used up its budget is refilled and has its
+ * deadline postponed by T.  If that happens ahead of the old deadline the
+ * refill waits until then, so a server never takes more than its bandwidth
+ * and its deadline never lies more than T ahead. */
+#ifndef configUSE_EDF_SERVERS
+    #define configUSE_EDF_SERVERS    0
+#endif
+
+#if ( configUSE_EDF_SERVERS == 1 )
+    #define taskEDF_SERVER_ARRIVAL( pxTCB )                  \
+    if( ( pxTCB )->ucServerIdle != ( uint8_t ) pdFALSE )     \
+    {                                                        \
+        prvEDFServerArrival( pxTCB );                        \
+    }
+#else
+    #define taskEDF_SERVER_ARRIVAL( pxTCB )
+#endif
+
+/* E.C. : Admission control.  Each EDF task is created with its worst case
+ * execution time, and a task that would make the task set unschedulable is
+ * refused with errTASK_NOT_ADMITTED.  With every deadline at least the period
+ * the total utilisation must not exceed 1.  Once a deadline is shorter than
+ * the period the processor demand is also checked, by Quick Processor-demand
+ * Analysis up to the synchronous busy period.  That needs a utilisation below
+ * 1, and a busy period that settles within configEDF_ADMISSION_MAX_STEPS
+ * steps and fits in a TickType_t, or the task is refused.  Each utilisation
+ * is rounded up to 2^-32, so a set loading the processor exactly fully may be
+ * refused.  A task created without a WCET is not accounted for. */
+#ifndef configEDF_ADMISSION_CONTROL
+    #define configEDF_ADMISSION_CONTROL    0
+#endif
+
+#ifndef configEDF_ADMISSION_MAX_STEPS
+    #define configEDF_ADMISSION_MAX_STEPS    1000
+#endif
+
+/* E.C. : Belongs with the other error codes in projdefs.h. */
+#ifndef errTASK_NOT_ADMITTED
+    #define errTASK_NOT_ADMITTED    ( -6 )
+#endif
+
+#define taskEDF_UTILISATION_ONE    ( ( uint64_t ) 1U << 32 )
+#define taskEDF_UTILISATION_OF( xWCET, xPeriod )    ( ( ( ( uint64_t ) ( xWCET ) << 32 ) + ( xPeriod ) - 1U ) / ( xPeriod ) )
+
+/* E.C. : The deadline of the jobs of an admitted task relative to their
+ * release.  A server has no deadline of its own and is analysed as a task
+ * with its budget due by the end of each of its periods. */
+#define taskEDF_ADMITTED_DEADLINE( pxTCB )    ( ( ( pxTCB )->xTaskRelativeDeadline != ( TickType_t ) 0U ) ? ( pxTCB )->xTaskRelativeDeadline : ( pxTCB )->xTaskPeriod )
+
+/* E.C. : Stack Resource Policy.  Each task using a resource declares it with
+ * vTaskSRPUseResource() and takes it with vTaskSRPLock(), which never blocks.
+ * The preemption level of a task is its relative deadline, a shorter one
+ * being a higher level, and the ceiling of a resource is the highest level of
+ * the tasks using it.  While resources are held the system ceiling is the
+ * highest of their ceilings, and a job released at a level no higher than the
+ * system ceiling is held back until the ceiling drops.  A job that has
+ * started never waits for a resource, so each job is blocked at most once,
+ * before it starts, and by one critical section, and resources cannot
+ * deadlock.  Locks nest, and a task must not block while it holds one. */
+#ifndef configUSE_EDF_SRP
+    #define configUSE_EDF_SRP    0
+#endif
+
+#ifndef configEDF_SRP_RESOURCES
+    #define configEDF_SRP_RESOURCES    4
+#endif
+
+#define taskEDF_PREEMPTION_LEVEL( pxTCB )    taskEDF_ADMITTED_DEADLINE( pxTCB )
+
+/* E.C. : Run-to-completion jobs.  A task created by
+ * xTaskPeriodicJobCreateStatic() has no stack of its own.  Each of its jobs is
+ * a call to its job function, made on one of configEDF_JOB_CARRIERS shared
+ * stacks of configEDF_JOB_STACK_DEPTH words, taken when the job first runs
+ * and given back once it has completed.  A job is only preempted by jobs with
+ * earlier deadlines, which complete first, so the stacks in use at once are
+ * at most the depth of preemption, the number of distinct relative deadlines
+ * of the job tasks.  A job must not block before it returns, and one held
+ * back by the deadline miss or budget policy keeps its stack.  0 for none. */
+#ifndef configEDF_JOB_CARRIERS
+    #define configEDF_JOB_CARRIERS    0
+#endif
+
+#ifndef configEDF_JOB_STACK_DEPTH
+    #define configEDF_JOB_STACK_DEPTH    configMINIMAL_STACK_SIZE
+#endif
+
+#if ( ( configEDF_JOB_CARRIERS > 0 ) && ( ( configSUPPORT_STATIC_ALLOCATION != 1 ) || ( INCLUDE_xTaskDelayUntil != 1 ) ) )
+    #error configEDF_JOB_CARRIERS needs configSUPPORT_STATIC_ALLOCATION and INCLUDE_xTaskDelayUntil to be set to 1
+#endif
+
+/* E.C. : pdFALSE for a job task while it has no carrier, so it has no stack to
+ * set up, check or measure. */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_JOB_CARRIERS > 0 ) )
+    #define taskEDF_HAS_OWN_STACK( pxTCB )    ( ( pxTCB )->pxStack != NULL )
+#else
+    #define taskEDF_HAS_OWN_STACK( pxTCB )    ( pdTRUE )
+#endif
+
+/* E.C. : Progress of the current job of a task, so each miss is counted once
+ * and a job that has completed is not checked again.  A job is DONE from
+ * xTaskWaitForNextPeriod(), or xTaskDelayUntil() called by a periodic task,
+ * until the next one is released, and DEFERRED while
+ * the kernel holds it back to go on as the job of the next release.  Only a
+ * task in one of those two states starts a job when it wakes, any other wake
+ * is the end of a block within the job. */
+#define taskEDF_JOB_ACTIVE      ( ( uint8_t ) 0 )
+#define taskEDF_JOB_MISSED      ( ( uint8_t ) 1 )
+#define taskEDF_JOB_DONE        ( ( uint8_t ) 2 )
+#define taskEDF_JOB_DEFERRED    ( ( uint8_t ) 3 )
+
+#define taskEDF_WAKE_RELEASES_JOB( pxTCB )    ( ( ( pxTCB )->ucEDFJobState >= taskEDF_JOB_DONE ) ? pdTRUE : pdFALSE )
+
+/* E.C. : pdTRUE if absolute deadline xA falls before xB.  Testing the
+ * difference keeps the order right across an overflow of the tick count, as
+ * long as the deadlines compared lie within half the tick range of each
+ * other. */
+#define taskEDF_DEADLINE_BEFORE( xA, xB )    ( ( ( TickType_t ) ( ( xA ) - ( xB ) ) > ( portMAX_DELAY >> 1 ) ) ? pdTRUE : pdFALSE )
+
+/* E.C. : The deadline a task is queued by when ready.  A task holding a
+ * mutex runs by the deadline it inherited from a task blocked on it, if that
+ * is earlier than the deadline of its own job, see xTaskPriorityInherit(). */
+#if ( configUSE_MUTEXES == 1 )
+    #define taskEDF_READY_DEADLINE( pxTCB )                                                                    \
+    ( ( ( ( pxTCB )->ucDeadlineInherited != ( uint8_t ) pdFALSE ) &&                                            \
+        ( taskEDF_DEADLINE_BEFORE( ( pxTCB )->xInheritedDeadline, ( pxTCB )->xTaskDeadline ) != pdFALSE ) ) ? \
+      ( pxTCB )->xInheritedDeadline : ( pxTCB )->xTaskDeadline )
+#else
+    #define taskEDF_READY_DEADLINE( pxTCB )    ( ( pxTCB )->xTaskDeadline )
+#endif
+
+/* E.C. : The most tasks that exist at the same time, the idle task and the
+ * timer task included. */
+#ifndef configEDF_MAX_TASKS
+    #define configEDF_MAX_TASKS    16
+#endif
+
+/* The heap is statically allocated.  A task that leaves the Ready state is
+ * only dropped from it once it reaches the top, so it can hold an entry for
+ * every task that exists, not just for those that are ready. */
+#ifndef configEDF_READY_HEAP_LENGTH
+    #define configEDF_READY_HEAP_LENGTH    configEDF_MAX_TASKS
+#endif
+
+/* Each bucket holds the deadlines of ( 1 << configEDF_BUCKET_SHIFT ) ticks, so
+ * the ring spans configEDF_READY_BUCKETS << configEDF_BUCKET_SHIFT ticks.  That
+ * span must exceed the longest relative deadline plus the worst lateness of a
+ * ready job, otherwise deadlines alias onto earlier buckets. */
+#ifndef configEDF_READY_BUCKETS
+    #define configEDF_READY_BUCKETS    64
+#endif
+
+#ifndef configEDF_BUCKET_SHIFT
+    #define configEDF_BUCKET_SHIFT    2
+#endif
+
+#if ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_DEADLINE_BUCKETS )
+    #if ( ( configEDF_READY_BUCKETS < 32 ) || ( configEDF_READY_BUCKETS > 1024 ) || ( ( configEDF_READY_BUCKETS & ( configEDF_READY_BUCKETS - 1 ) ) != 0 ) )
+        #error configEDF_READY_BUCKETS must be a power of two between 32 and 1024
+    #endif
+
+    #define taskEDF_BUCKET_WINDOW         ( ( TickType_t ) configEDF_READY_BUCKETS << configEDF_BUCKET_SHIFT )
+    #define taskEDF_BUCKET_OF( xDeadline )    ( ( UBaseType_t ) ( ( xDeadline ) >> configEDF_BUCKET_SHIFT ) & ( ( UBaseType_t ) configEDF_READY_BUCKETS - 1U ) )
+    #define taskEDF_BUCKET_WORDS          ( configEDF_READY_BUCKETS / 32 )
+
+    /* E.C. : A relative deadline must leave room in the window for the
+     * lateness of the job, so one that fills it is refused at creation. */
+    #define taskEDF_DEADLINE_FITS( xRelativeDeadline )    ( ( ( xRelativeDeadline ) < taskEDF_BUCKET_WINDOW ) ? pdTRUE : pdFALSE )
+#else
+    #define taskEDF_DEADLINE_FITS( xRelativeDeadline )    ( pdTRUE )
+#endif
+
+/* E.C. : Returned when a task is created with a relative deadline that does
+ * not fit in the window of the deadline buckets. */
+#ifndef errTASK_DEADLINE_OUT_OF_RANGE
+    #define errTASK_DEADLINE_OUT_OF_RANGE    ( -7 )
+#endif
+
+/* E.C. : Timing wheel for the delayed tasks.  A task that blocks for fewer than
+ * configEDF_DELAYED_WHEEL_SLOTS ticks is appended to the slot of its wake time,
+ * which costs O(1) whatever the number of blocked tasks, and the tick only has
+ * to look at one slot.  Longer delays wait in a far list, kept in order of the
+ * time left, and move to their slot once the wake time comes within one turn
+ * of the wheel.  As the far list is ordered on the time left rather than on
+ * the wake time itself there is no overflow list to switch when the tick count
+ * wraps.  0 keeps the sorted pxDelayedTaskList / pxOverflowDelayedTaskList. */
+#ifndef configEDF_DELAYED_WHEEL_SLOTS
+    #define configEDF_DELAYED_WHEEL_SLOTS    0
+#endif
+
+#if ( configEDF_DELAYED_WHEEL_SLOTS > 0 )
+    #if ( ( configEDF_DELAYED_WHEEL_SLOTS < 32 ) || ( configEDF_DELAYED_WHEEL_SLOTS > 1024 ) || ( ( configEDF_DELAYED_WHEEL_SLOTS & ( configEDF_DELAYED_WHEEL_SLOTS - 1 ) ) != 0 ) )
+        #error configEDF_DELAYED_WHEEL_SLOTS must be 0 or a power of two between 32 and 1024
+    #endif
+
+    #define taskEDF_WHEEL_SLOT_OF( xTimeToWake )    ( ( UBaseType_t ) ( xTimeToWake ) & ( ( UBaseType_t ) configEDF_DELAYED_WHEEL_SLOTS - 1U ) )
+    #define taskEDF_WHEEL_WORDS                   ( configEDF_DELAYED_WHEEL_SLOTS / 32 )
+#endif
+
+#if ( ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_DEADLINE_BUCKETS ) || ( configEDF_DELAYED_WHEEL_SLOTS > 0 ) )
+
+/* Index of the least significant set bit of a non-zero 32-bit word.  As with
+ * portGET_HIGHEST_PRIORITY(), a port can supply an instruction based version;
+ * the generic one is a branch free de Bruijn multiply. */
+    #ifdef portEDF_LOWEST_SET_BIT
+        #define taskEDF_LOWEST_SET_BIT( ulBits )    portEDF_LOWEST_SET_BIT( ulBits )
+    #else
+        #define taskEDF_LOWEST_SET_BIT( ulBits )    ( ( UBaseType_t ) ucEDFDeBruijnBitPosition[ ( ( uint32_t ) ( ( ( ulBits ) & ( 0UL - ( ulBits ) ) ) * 0x077CB531UL ) ) >> 27 ] )
+    #endif
+#endif
+
 #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
 
 /* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 0 then task selection is
@@ -196,9 +520,25 @@
 
 /*-----------------------------------------------------------*/
 
+#if ( configEDF_DELAYED_WHEEL_SLOTS > 0 )
+
+/* E.C. : The timing wheel only ever compares the ticks left until a wake time,
+ * so nothing has to move when the tick count overflows.  Every tick is seen by
+ * xTaskIncrementTick() and xNextTaskUnblockTime is never later than the first
+ * wake time, so the tasks are due when the tick count reaches it. */
+    #define taskSWITCH_DELAYED_LISTS()    \
+    {                                     \
+        xNumOfOverflows++;                \
+    }
+
+    #define taskDELAYED_TASKS_DUE( xConstTickCount )    ( ( xConstTickCount ) == xNextTaskUnblockTime )
+    #define taskDUE_DELAYED_TASK_LIST( xConstTickCount )    prvEDFWheelDueList( xConstTickCount )
+
+#else /* configEDF_DELAYED_WHEEL_SLOTS */
+
 /* pxDelayedTaskList and pxOverflowDelayedTaskList are switched when the tick
  * count overflows. */
-#define taskSWITCH_DELAYED_LISTS()                                                \
+    #define taskSWITCH_DELAYED_LISTS()                                            \
     {                                                                             \
         List_t * pxTemp;                                                          \
                                                                                   \
@@ -212,16 +552,116 @@
         prvResetNextTaskUnblockTime();                                            \
     }
 
+    #define taskDELAYED_TASKS_DUE( xConstTickCount )    ( ( xConstTickCount ) >= xNextTaskUnblockTime )
+    #define taskDUE_DELAYED_TASK_LIST( xConstTickCount )    pxDelayedTaskList
+
+#endif /* configEDF_DELAYED_WHEEL_SLOTS */
+
 
 /*  E.C. : */
 /*
  * Place the task represented by pxTCB into the appropriate ready list for
- * the task.  It is inserted based on its deadline.
+ * the task.  It is inserted based on the deadline of its current job, which
+ * replaces the wake time left in the list item by a block.
  */
 #if ( configUSE_EDF_SCHEDULER == 1 )
+	#if ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_BINARY_HEAP )
+	/* E.C. : xReadyTasksListEDF only records that the task is ready, the
+	 * deadline order is kept by the heap. */
+	#define prvAddTaskToReadyList( pxTCB ) 														 	\
+		traceMOVED_TASK_TO_READY_STATE(pxTCB);														 \
+		taskEDF_SERVER_ARRIVAL( pxTCB );															 \
+		listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), taskEDF_READY_DEADLINE( pxTCB ) );	 \
+		listINSERT_END( &(xReadyTasksListEDF), &( ( pxTCB )->xStateListItem ) );					 \
+		prvEDFHeapInsert( pxTCB );
+
+	#define taskEDF_EARLIEST_READY_TASK()    prvEDFHeapGetEarliest()
+	#elif ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_DEADLINE_BUCKETS )
+	/* E.C. : the task goes into the bucket of its deadline, the bitmap
+	 * records that the bucket is no longer empty. */
+	#define prvAddTaskToReadyList( pxTCB ) 														 	\
+		traceMOVED_TASK_TO_READY_STATE(pxTCB);														 \
+		taskEDF_SERVER_ARRIVAL( pxTCB );															 \
+		listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), taskEDF_READY_DEADLINE( pxTCB ) );	 \
+		prvEDFBucketInsert( pxTCB );
+
+	#define taskEDF_EARLIEST_READY_TASK()    prvEDFBucketGetEarliest()
+	#else
 	#define prvAddTaskToReadyList( pxTCB ) 														 	\
 		traceMOVED_TASK_TO_READY_STATE(pxTCB);														 \
-		vListInsert( &(xReadyTasksListEDF), &( ( pxTCB )->xStateListItem ) );
+		taskEDF_SERVER_ARRIVAL( pxTCB );															 \
+		listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), taskEDF_READY_DEADLINE( pxTCB ) );	 \
+		prvEDFListInsert( &(xReadyTasksListEDF), NULL, &( ( pxTCB )->xStateListItem ) );
+
+	#define taskEDF_EARLIEST_READY_TASK()    ( ( listLIST_IS_EMPTY( &( xReadyTasksListEDF ) ) != pdFALSE ) ? NULL : ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( xReadyTasksListEDF ) ) )
+
+	/* E.C. : Jobs released by the same tick are first sorted among themselves
+	 * and then merged into the ready list in a single walk, rather than each
+	 * walking the ready list from its head. */
+	#define prvAddReleasedTaskToReadyList( pxTCB ) 													\
+		traceMOVED_TASK_TO_READY_STATE(pxTCB);														 \
+		taskEDF_SERVER_ARRIVAL( pxTCB );															 \
+		listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), taskEDF_READY_DEADLINE( pxTCB ) );	 \
+		prvEDFListInsert( &(xEDFReleasedTasksList), NULL, &( ( pxTCB )->xStateListItem ) );
+
+	#define taskMERGE_RELEASED_TASKS()														 		\
+	{																								 \
+		if( listLIST_IS_EMPTY( &(xEDFReleasedTasksList) ) == pdFALSE )								 \
+		{																							 \
+			prvEDFMergeReleasedTasks();																 \
+		}																							 \
+	}
+	#endif
+
+	/* E.C. : Run the ready job with the earliest deadline, or the idle task
+	 * once there is none.  taskEDF_EARLIEST_READY_TASK() gives NULL then, as
+	 * picking a background job moves their round robin on, which is only to
+	 * be done for a job that is going to run. */
+	#define taskSELECT_EARLIEST_DEADLINE_TASK()										\
+	{																				\
+		TCB_t * const pxEarliestTCB = taskEDF_EARLIEST_READY_TASK();				\
+																					\
+		pxCurrentTCB = ( pxEarliestTCB != NULL ) ? pxEarliestTCB : taskEDF_IDLE_TASK();	\
+	}
+
+	/* E.C. : The heap and the buckets already insert in O(log n) or O(1), so
+	 * there is nothing to gain from batching the releases. */
+	#ifndef prvAddReleasedTaskToReadyList
+		#define prvAddReleasedTaskToReadyList( pxTCB )    prvAddTaskToReadyList( pxTCB )
+		#define taskMERGE_RELEASED_TASKS()
+	#endif
+
+	/* E.C. : pdTRUE if pxTCB is queued by its deadline, that is ready and not
+	 * throttled. */
+	#if ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_DEADLINE_BUCKETS )
+		#define taskEDF_IN_READY_QUEUE( pxTCB )																	\
+			( ( listLIST_ITEM_CONTAINER( &( ( pxTCB )->xStateListItem ) ) >= &( xEDFReadyBuckets[ 0 ] ) ) &&			\
+			  ( listLIST_ITEM_CONTAINER( &( ( pxTCB )->xStateListItem ) ) < &( xEDFReadyBuckets[ configEDF_READY_BUCKETS ] ) ) )
+	#else
+		#define taskEDF_IN_READY_QUEUE( pxTCB )    ( listLIST_ITEM_CONTAINER( &( ( pxTCB )->xStateListItem ) ) == &xReadyTasksListEDF )
+	#endif
+
+	/* E.C. : Jobs throttled to the background wait in the idle priority ready
+	 * list, and take turns with the idle task once the EDF ready queue is
+	 * empty. */
+	#if ( taskEDF_BACKGROUND_JOBS == 1 )
+		#define taskEDF_IDLE_TASK()    prvEDFGetBackgroundTask()
+		#define taskEDF_IN_BACKGROUND( pxTCB )    ( listLIST_ITEM_CONTAINER( &( ( pxTCB )->xStateListItem ) ) == &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) )
+	#else
+		#define taskEDF_IDLE_TASK()    xIdleTaskHandle
+		#define taskEDF_IN_BACKGROUND( pxTCB )    ( ( pxTCB ) == xIdleTaskHandle )
+	#endif
+
+	/* E.C. : pdTRUE if pxTCB, just made ready, runs before the running task,
+	 * that is if it is queued by an earlier deadline or the running task has
+	 * no deadline to run by, being the idle task or a job throttled to the
+	 * background.  Every site that makes a task ready decides on a context
+	 * switch by it, in place of the priority test made without EDF.  A tie
+	 * does not switch, as the running job would have to resume later for
+	 * nothing. */
+	#define taskEDF_PREEMPTS_CURRENT( pxTCB )																\
+		( ( ( taskEDF_IN_BACKGROUND( pxCurrentTCB ) != pdFALSE ) ||											\
+			( taskEDF_DEADLINE_BEFORE( taskEDF_READY_DEADLINE( pxTCB ), taskEDF_READY_DEADLINE( pxCurrentTCB ) ) != pdFALSE ) ) ? pdTRUE : pdFALSE )
 #else	
 /*
  * Place the task represented by pxTCB into the appropriate ready list for
@@ -339,9 +779,78 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
         int iTaskErrno;
     #endif
 	
-	/* E.C. : the period of a task */
+	/* E.C. : the period of a task, the deadline of each job relative to its
+	 * release, the release of the first job relative to the creation of the
+	 * task, and the absolute deadline of its current job.  The deadline is
+	 * kept here as xStateListItem holds the wake time while the task is
+	 * blocked.  xTaskRelease is the release of the job the task is running,
+	 * as kept by xTaskWaitForNextPeriod() and xTaskDelayUntil(). */
 	#if ( configUSE_EDF_SCHEDULER == 1 )
 		TickType_t xTaskPeriod;
+		TickType_t xTaskRelativeDeadline;
+		TickType_t xTaskOffset;
+		TickType_t xTaskDeadline;
+		TickType_t xTaskRelease;
+	#endif
+
+	/* E.C. : deadlines missed so far, the largest lateness seen in ticks, and
+	 * the progress of the current job, one of the taskEDF_JOB_ values */
+	#if ( configUSE_EDF_SCHEDULER == 1 )
+		UBaseType_t uxDeadlineMisses;
+		TickType_t xMaxLateness;
+		uint8_t ucEDFJobState;
+	#endif
+
+	/* E.C. : the execution budget of each job, 0 for none, and the run time
+	 * charged to the current job up to the last switch out, both in the
+	 * units of the run time stats counter */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_BUDGET_ENFORCEMENT == 1 ) )
+		configRUN_TIME_COUNTER_TYPE ulTaskBudget;
+		configRUN_TIME_COUNTER_TYPE ulJobRunTime;
+	#endif
+
+	/* E.C. : the budget and the period of the server of the task, its budget
+	 * left, its deadline, and whether it has no pending work, so the next
+	 * time the task becomes ready is an arrival.  xServerBudget is 0 for a
+	 * task without a server. */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SERVERS == 1 ) )
+		TickType_t xServerBudget;
+		TickType_t xServerCapacity;
+		TickType_t xServerDeadline;
+		uint8_t ucServerIdle;
+	#endif
+
+	/* E.C. : the worst case execution time of each job in ticks, and the
+	 * next task in the set accounted for by the admission test */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_ADMISSION_CONTROL == 1 ) )
+		TickType_t xTaskWCET;
+		struct tskTaskControlBlock * pxEDFNextAdmitted;
+	#endif
+
+	/* E.C. : the deadline inherited through the mutexes the task holds, and
+	 * whether it has inherited one */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_MUTEXES == 1 ) )
+		TickType_t xInheritedDeadline;
+		uint8_t ucDeadlineInherited;
+	#endif
+
+	/* E.C. : SRP resources held by the task */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) )
+		UBaseType_t uxSRPResourcesHeld;
+	#endif
+
+	/* E.C. : the job function of a job task and its parameter, NULL for a
+	 * task with a stack of its own, and the carrier its current job runs on,
+	 * NULL between jobs.  The free carriers are linked through it. */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_JOB_CARRIERS > 0 ) )
+		TaskFunction_t pxJobCode;
+		void * pvJobParameters;
+		struct tskTaskControlBlock * pxJobCarrier;
+	#endif
+
+	/* E.C. : position of the task in the EDF ready heap, 0 when not in it */
+	#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_BINARY_HEAP ) )
+		UBaseType_t uxEDFHeapIndex;
 	#endif
 } tskTCB;
 
@@ -368,7 +877,99 @@ PRIVILEGED_DATA static List_t xPendingReadyList;                         /*< Tas
 /* Create a new ready tasks list based on deadline ordering */
 #if ( configUSE_EDF_SCHEDULER == 1 )
 	PRIVILEGED_DATA static List_t xReadyTasksListEDF;
+#endif
+
+/* E.C. : Jobs released by the current tick, in deadline order, waiting to be
+ * merged into the sorted ready list. */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_SORTED_LIST ) )
+	PRIVILEGED_DATA static List_t xEDFReleasedTasksList;
+#endif
+
+/* E.C. : Binary min-heap of the ready tasks ordered by absolute deadline.  Slot
+ * 0 is unused so the parent of slot n is always slot n / 2.  The deadline is
+ * copied into the slot when the task is inserted because the value of the
+ * xStateListItem is reused for the wake time once the task blocks. */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_BINARY_HEAP ) )
+	typedef struct xEDF_HEAP_NODE
+	{
+		TickType_t xDeadline;
+		struct tskTaskControlBlock * pxTCB;
+	} EDFHeapNode_t;
+
+	PRIVILEGED_DATA static EDFHeapNode_t xEDFReadyHeap[ configEDF_READY_HEAP_LENGTH + 1 ];
+	PRIVILEGED_DATA static UBaseType_t uxEDFReadyHeapSize = ( UBaseType_t ) 0U;
+#endif
+
+/* E.C. : Ring of deadline buckets.  Bit n of ulEDFBucketBits[ w ] is set when
+ * bucket ( w * 32 ) + n may hold ready tasks, and bit w of ulEDFBucketWords
+ * is set when ulEDFBucketBits[ w ] is not zero.  xEDFBucketFloor is a lower
+ * bound on the deadline of every ready task and is where the search starts. */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_DEADLINE_BUCKETS ) )
+	PRIVILEGED_DATA static List_t xEDFReadyBuckets[ configEDF_READY_BUCKETS ];
+	PRIVILEGED_DATA static uint32_t ulEDFBucketBits[ taskEDF_BUCKET_WORDS ];
+	PRIVILEGED_DATA static uint32_t ulEDFBucketWords = 0UL;
+	PRIVILEGED_DATA static TickType_t xEDFBucketFloor = ( TickType_t ) 0U;
+#endif
+
+#if ( ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_DEADLINE_BUCKETS ) || ( configEDF_DELAYED_WHEEL_SLOTS > 0 ) )
+	#ifndef portEDF_LOWEST_SET_BIT
+		static const uint8_t ucEDFDeBruijnBitPosition[ 32 ] =
+		{
+			0U, 1U, 28U, 2U, 29U, 14U, 24U, 3U, 30U, 22U, 20U, 15U, 25U, 17U, 4U, 8U,
+			31U, 27U, 13U, 23U, 21U, 19U, 16U, 7U, 26U, 12U, 18U, 6U, 11U, 5U, 10U, 9U
+		};
+	#endif
+#endif
+
+/* E.C. : Slots of the delayed task timing wheel.  Slot n holds the tasks due to
+ * wake at a tick whose low bits equal n, and as only wake times less than one
+ * turn ahead are held they are all due on the same tick.  The bitmaps mark the
+ * slots that may hold tasks in the same way as for the deadline buckets.
+ * xEDFDelayedFarList holds the tasks due further ahead, in order of the ticks
+ * left until they wake. */
+#if ( configEDF_DELAYED_WHEEL_SLOTS > 0 )
+	PRIVILEGED_DATA static List_t xEDFDelayedWheel[ configEDF_DELAYED_WHEEL_SLOTS ];
+	PRIVILEGED_DATA static uint32_t ulEDFWheelBits[ taskEDF_WHEEL_WORDS ];
+	PRIVILEGED_DATA static uint32_t ulEDFWheelWords = 0UL;
+	PRIVILEGED_DATA static List_t xEDFDelayedFarList;
 #endif							 
+/* E.C. : The tasks accounted for by the admission test, their total
+ * utilisation scaled by taskEDF_UTILISATION_ONE, and how many of them have a
+ * deadline shorter than their period. */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_ADMISSION_CONTROL == 1 ) )
+	PRIVILEGED_DATA static TCB_t * pxEDFAdmittedTasks = NULL;
+	PRIVILEGED_DATA static uint64_t ullEDFUtilisation = 0U;
+	PRIVILEGED_DATA static UBaseType_t uxEDFConstrainedTasks = ( UBaseType_t ) 0U;
+#endif
+
+/* E.C. : The SRP resources, each with its ceiling, the task holding it, the
+ * system ceiling it raised and how many resources were held before it, so
+ * locks are checked to nest.  The system ceiling is portMAX_DELAY while no
+ * resource is held.  Jobs held back by the system ceiling wait in
+ * xEDFSRPHeldTasksList, by preemption level. */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) )
+	typedef struct xEDF_SRP_RESOURCE
+	{
+		TickType_t xCeiling;
+		TickType_t xPreviousCeiling;
+		struct tskTaskControlBlock * pxHolder;
+		UBaseType_t uxDepth;
+	} EDFResource_t;
+
+	PRIVILEGED_DATA static EDFResource_t xEDFSRPResources[ configEDF_SRP_RESOURCES ];
+	PRIVILEGED_DATA static TickType_t xEDFSystemCeiling = portMAX_DELAY;
+	PRIVILEGED_DATA static UBaseType_t uxEDFSRPLocked = ( UBaseType_t ) 0U;
+	PRIVILEGED_DATA static List_t xEDFSRPHeldTasksList;
+#endif
+
+/* E.C. : The carriers of run-to-completion jobs, each a context that is never
+ * scheduled itself and a stack, and the list of those not carrying a job. */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_JOB_CARRIERS > 0 ) )
+	PRIVILEGED_DATA static TCB_t xEDFJobCarriers[ configEDF_JOB_CARRIERS ];
+	PRIVILEGED_DATA static StackType_t xEDFJobStacks[ configEDF_JOB_CARRIERS ][ configEDF_JOB_STACK_DEPTH ];
+	PRIVILEGED_DATA static TCB_t * pxEDFFreeJobCarriers = NULL;
+#endif
+
 #if ( INCLUDE_vTaskDelete == 1 )
 
     PRIVILEGED_DATA static List_t xTasksWaitingTermination; /*< Tasks that have been deleted - but their memory not yet freed. */
@@ -415,6 +1016,14 @@ const volatile UBaseType_t uxTopUsedPriority = configMAX_PRIORITIES - 1U;
  * accessed from a critical section. */
 PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended = ( UBaseType_t ) pdFALSE;
 
+/* E.C. : Ticks on which released jobs did or did not preempt the running job,
+ * to measure the context switches saved by the deadline test in
+ * xTaskIncrementTick(). */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_TRACE_FACILITY == 1 ) )
+    PRIVILEGED_DATA static volatile UBaseType_t uxEDFReleaseSwitchesPerformed = ( UBaseType_t ) 0U;
+    PRIVILEGED_DATA static volatile UBaseType_t uxEDFReleaseSwitchesAvoided = ( UBaseType_t ) 0U;
+#endif
+
 #if ( configGENERATE_RUN_TIME_STATS == 1 )
 
 /* Do not move these variables to function scope as doing so prevents the
@@ -546,115 +1155,421 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
  */
 static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
-
 /*
- * Helper function used to pad task names with spaces when printing out
- * human readable tables of task information.
+ * E.C. : Insert pxNewListItem into pxList, a list in deadline order, walking
+ * on from pxPrevious, or from the head if pxPrevious is NULL.  Unlike
+ * vListInsert() the order stays right when the deadlines straddle an overflow
+ * of the tick count.
  */
-    static char * prvWriteNameToBuffer( char * pcBuffer,
-                                        const char * pcTaskName ) PRIVILEGED_FUNCTION;
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static void prvEDFListInsert( List_t * const pxList,
+                                  ListItem_t * pxPrevious,
+                                  ListItem_t * const pxNewListItem ) PRIVILEGED_FUNCTION;
 
 #endif
 
 /*
- * Called after a Task_t structure has been allocated either statically or
- * dynamically to fill in the structure's members.
+ * E.C. : Move every task from xEDFReleasedTasksList into xReadyTasksListEDF.
+ * Both lists are in deadline order so the ready list is walked only once.
  */
-static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
-                                  const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-                                  const uint32_t ulStackDepth,
-                                  void * const pvParameters,
-                                  UBaseType_t uxPriority,
-                                  TaskHandle_t * const pxCreatedTask,
-                                  TCB_t * pxNewTCB,
-                                  const MemoryRegion_t * const xRegions ) PRIVILEGED_FUNCTION;
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_SORTED_LIST ) )
+
+    static void prvEDFMergeReleasedTasks( void ) PRIVILEGED_FUNCTION;
+
+#endif
 
 /*
- * Called after a new task has been created and initialised to place the task
- * under the control of the scheduler.
+ * E.C. : Place a task that is not running in the Blocked state, to wake at
+ * xTimeToWake when its next job is released.  Used for a task created with an
+ * offset and for a task whose job is deferred.
  */
-static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static void prvEDFAddTaskToDelayedList( TCB_t * pxTCB,
+                                            const TickType_t xTimeToWake ) PRIVILEGED_FUNCTION;
+
+#endif
 
 /*
- * freertos_tasks_c_additions_init() should only be called if the user definable
- * macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is the only macro
- * called by the function.
+ * E.C. : Start the job of pxTCB released at xRelease.  Its absolute deadline
+ * is taken from the release, never from the tick that handles it, and this is
+ * the only place it is worked out for a new job.  The caller puts the task in
+ * the Ready state.
  */
-#ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
+#if ( configUSE_EDF_SCHEDULER == 1 )
 
-    static void freertos_tasks_c_additions_init( void ) PRIVILEGED_FUNCTION;
+    static void prvEDFReleaseJob( TCB_t * pxTCB,
+                                  const TickType_t xRelease ) PRIVILEGED_FUNCTION;
 
 #endif
 
-/*-----------------------------------------------------------*/
+/*
+ * E.C. : Check the current job of pxTCB against its deadline at
+ * xConstTickCount.  Returns pdTRUE if the job is late.  The first time a job
+ * is found late the miss is counted, traced and passed to
+ * vApplicationDeadlineMissHook().
+ */
+#if ( configUSE_EDF_SCHEDULER == 1 )
 
-#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    static BaseType_t prvEDFCheckDeadline( TCB_t * pxTCB,
+                                           const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
 
-    TaskHandle_t xTaskCreateStatic( TaskFunction_t pxTaskCode,
-                                    const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-                                    const uint32_t ulStackDepth,
-                                    void * const pvParameters,
-                                    UBaseType_t uxPriority,
-                                    StackType_t * const puxStackBuffer,
-                                    StaticTask_t * const pxTaskBuffer )
-    {
-        TCB_t * pxNewTCB;
-        TaskHandle_t xReturn;
+#endif
 
-        configASSERT( puxStackBuffer != NULL );
-        configASSERT( pxTaskBuffer != NULL );
+/*
+ * E.C. : Complete the job of the running task, which then waits for the
+ * release at *pxNextRelease, or starts the job of that release at once if it
+ * is already due.  A late job is checked against its deadline first, and under
+ * the skip policy *pxNextRelease moves on a period.  Returns pdTRUE if the task
+ * has to block.  Called with the scheduler suspended.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( INCLUDE_xTaskDelayUntil == 1 ) )
 
-        #if ( configASSERT_DEFINED == 1 )
-            {
-                /* Sanity check that the size of the structure used to declare a
-                 * variable of type StaticTask_t equals the size of the real task
-                 * structure. */
-                volatile size_t xSize = sizeof( StaticTask_t );
-                configASSERT( xSize == sizeof( TCB_t ) );
-                ( void ) xSize; /* Prevent lint warning when configASSERT() is not used. */
-            }
-        #endif /* configASSERT_DEFINED */
+    static BaseType_t prvEDFCompleteJob( TickType_t * const pxNextRelease,
+                                         const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
 
-        if( ( pxTaskBuffer != NULL ) && ( puxStackBuffer != NULL ) )
-        {
-            /* The memory used for the task's TCB and stack are passed into this
-             * function - use them. */
-            pxNewTCB = ( TCB_t * ) pxTaskBuffer; /*lint !e740 !e9087 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
-            pxNewTCB->pxStack = ( StackType_t * ) puxStackBuffer;
+#endif
 
-            #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
-                {
-                    /* Tasks can be created statically or dynamically, so note this
-                     * task was created statically in case the task is later deleted. */
-                    pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_AND_TCB;
-                }
-            #endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+/*
+ * E.C. : Take a task whose job has missed its deadline or used up its budget
+ * out of the Ready state until its next release.  Returns pdFALSE, leaving the
+ * task alone, if it is not in the Ready state.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( taskEDF_DEFER_JOBS ) )
 
-            prvInitialiseNewTask( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, &xReturn, pxNewTCB, NULL );
-            prvAddNewTaskToReadyList( pxNewTCB );
-        }
-        else
-        {
-            xReturn = NULL;
-        }
+    static BaseType_t prvEDFDeferJob( TCB_t * pxTCB,
+                                      const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
 
-        return xReturn;
-    }
+#endif
 
-#endif /* SUPPORT_STATIC_ALLOCATION */
-/*-----------------------------------------------------------*/
+/*
+ * E.C. : Move a task whose job has used up its budget from the EDF ready queue
+ * to the background, and pick the task to run when the EDF ready queue is
+ * empty, the idle task or a throttled job in turn.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( taskEDF_BACKGROUND_JOBS ) )
 
-#if ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+    static void prvEDFMoveJobToBackground( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
 
-    BaseType_t xTaskCreateRestrictedStatic( const TaskParameters_t * const pxTaskDefinition,
-                                            TaskHandle_t * pxCreatedTask )
-    {
-        TCB_t * pxNewTCB;
-        BaseType_t xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+    static TCB_t * prvEDFGetBackgroundTask( void ) PRIVILEGED_FUNCTION;
 
-        configASSERT( pxTaskDefinition->puxStackBuffer != NULL );
-        configASSERT( pxTaskDefinition->pxTaskBuffer != NULL );
+#endif
+
+/*
+ * E.C. : Give a task that is in the Ready state a new deadline and move it to
+ * the place of that deadline in the EDF ready queue.  Passing its own
+ * deadline moves it after the deadline it inherited changed.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( ( INCLUDE_xTaskDelayUntil == 1 ) || ( configUSE_EDF_SERVERS == 1 ) || ( configUSE_MUTEXES == 1 ) ) )
+
+    static void prvEDFSetReadyTaskDeadline( TCB_t * pxTCB,
+                                            const TickType_t xDeadline ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : Run the constant bandwidth server of pxTCB.  prvEDFServerArrival()
+ * applies the arrival rule as the task becomes ready after blocking.
+ * prvEDFServerCharge() charges the running server for the tick, refilling and
+ * postponing it once its budget is used up.  Returns pdTRUE if the server was
+ * postponed.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SERVERS == 1 ) )
+
+    static void prvEDFServerArrival( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static BaseType_t prvEDFServerCharge( TCB_t * pxTCB,
+                                          const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : Admission control.  prvEDFAdmissionTest() returns pdTRUE if a task
+ * with the given timing can join the admitted tasks with every deadline still
+ * met.  prvEDFAdmitTask() and prvEDFWithdrawTask() add a created task to the
+ * admitted tasks and take a deleted one out.  The others are helpers of the
+ * test, over the admitted tasks and the candidate: the synchronous busy
+ * period, 0 if it does not settle in time, the processor demand of the jobs
+ * due by xInterval, and the last absolute deadline before xInterval.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_ADMISSION_CONTROL == 1 ) )
+
+    static BaseType_t prvEDFAdmissionTest( const TickType_t xWCET,
+                                           const TickType_t xDeadline,
+                                           const TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+
+    static void prvEDFAdmitTask( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static void prvEDFWithdrawTask( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static TickType_t prvEDFBusyPeriod( const TickType_t xWCET,
+                                        const TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+
+    static uint64_t prvEDFProcessorDemand( const TickType_t xInterval,
+                                           const TickType_t xWCET,
+                                           const TickType_t xDeadline,
+                                           const TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+
+    static TickType_t prvEDFLastDeadlineBefore( const TickType_t xInterval,
+                                                const TickType_t xDeadline,
+                                                const TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : Hold back a task about to be made ready if its preemption level is
+ * not above the system ceiling.  Returns pdTRUE if the task was held.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) )
+
+    static BaseType_t prvEDFSRPHoldJob( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : Place in the Ready state a task that was blocked, suspended or has
+ * just been created.  Under SRP its job is held back instead while its
+ * preemption level is not above the system ceiling, or it could preempt the
+ * holder of a resource it is about to take.  Returns pdTRUE if the task was
+ * queued, so only then can it call for a context switch.  A ready task that is
+ * only queued again, for a new deadline, goes through prvAddTaskToReadyList().
+ */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static BaseType_t prvAddUnblockedTaskToReadyList( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : The carriers of run-to-completion jobs.  prvEDFJobCarrier() is the
+ * code each carrier runs, the jobs of the task it carries one after the
+ * other.  prvEDFInitialiseJobCarriers() sets up their contexts on their
+ * stacks.  prvEDFReleaseJobCarrier() takes back the carrier of the task being
+ * switched out if its job has completed, and prvEDFBindJobCarrier() gives one
+ * to the task switched in if it is a job task without one.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_JOB_CARRIERS > 0 ) )
+
+    static portTASK_FUNCTION_PROTO( prvEDFJobCarrier, pvParameters ) PRIVILEGED_FUNCTION;
+
+    static void prvEDFInitialiseJobCarriers( void ) PRIVILEGED_FUNCTION;
+
+    static void prvEDFReleaseJobCarrier( void ) PRIVILEGED_FUNCTION;
+
+    static void prvEDFBindJobCarrier( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : Maintain the EDF ready heap.  prvEDFHeapInsert() adds the task, or
+ * moves it if it is already held, using the deadline stored in its
+ * xStateListItem.  Tasks that have left xReadyTasksListEDF are only discarded
+ * lazily by prvEDFHeapGetEarliest(), so blocking does not touch the heap.
+ * prvEDFHeapGetEarliest() returns NULL if no job is ready.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_BINARY_HEAP ) )
+
+    static void prvEDFHeapInsert( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static void prvEDFHeapRemove( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static TCB_t * prvEDFHeapGetEarliest( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : Maintain the EDF deadline buckets.  Bits of buckets that have been
+ * emptied by a task leaving the Ready state are cleared lazily by
+ * prvEDFBucketGetEarliest(), which at most doubles the constant search cost.
+ * prvEDFBucketGetEarliest() returns NULL if no job is ready.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_DEADLINE_BUCKETS ) )
+
+    static void prvEDFBucketInsert( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static void prvEDFBucketRemove( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+    static TCB_t * prvEDFBucketGetEarliest( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : Returns pdTRUE if the EDF ready queue is empty, so only the idle task
+ * is ready and the tick can be suppressed until the next release.
+ */
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_TICKLESS_IDLE != 0 ) )
+
+    static BaseType_t prvEDFOnlyIdleTaskReady( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : Maintain the delayed task timing wheel.  prvEDFWheelInsert() places a
+ * blocked task in the slot of its wake time, or in the far list if that is a
+ * turn or more after xConstTickCount.  prvEDFWheelDueList() moves the far
+ * tasks that have come within one turn onto the wheel and returns the slot
+ * holding the tasks due to wake at xConstTickCount.
+ */
+#if ( configEDF_DELAYED_WHEEL_SLOTS > 0 )
+
+    static void prvEDFWheelInsert( ListItem_t * const pxStateListItem,
+                                   const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+    static List_t * prvEDFWheelDueList( const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
+
+/*
+ * Helper function used to pad task names with spaces when printing out
+ * human readable tables of task information.
+ */
+    static char * prvWriteNameToBuffer( char * pcBuffer,
+                                        const char * pcTaskName ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Called after a Task_t structure has been allocated either statically or
+ * dynamically to fill in the structure's members.
+ */
+static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
+                                  const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                  const uint32_t ulStackDepth,
+                                  void * const pvParameters,
+                                  UBaseType_t uxPriority,
+                                  TaskHandle_t * const pxCreatedTask,
+                                  TCB_t * pxNewTCB,
+                                  const MemoryRegion_t * const xRegions ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called after a new task has been created and initialised to place the task
+ * under the control of the scheduler.
+ */
+static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * E.C. : Initialise a task for the EDF creation functions, which set its
+ * timing before adding it to the ready list.  The TCB and the stack are the
+ * buffers passed in, or are allocated when pxTaskBuffer is NULL.  A job task
+ * is given a TCB and no stack.
+ */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static TCB_t * prvEDFCreateTask( TaskFunction_t pxTaskCode,
+                                     const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                     const uint32_t ulStackDepth,
+                                     void * const pvParameters,
+                                     UBaseType_t uxPriority,
+                                     TaskHandle_t * const pxCreatedTask,
+                                     StackType_t * const puxStackBuffer,
+                                     StaticTask_t * const pxTaskBuffer ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * E.C. : The common part of xTaskPeriodicCreateEx() and
+ * xTaskPeriodicCreateStatic().
+ */
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static BaseType_t prvEDFCreatePeriodicTask( TaskFunction_t pxTaskCode,
+                                                const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                                const uint32_t ulStackDepth,
+                                                void * const pvParameters,
+                                                UBaseType_t uxPriority,
+                                                TaskHandle_t * const pxCreatedTask,
+                                                StackType_t * const puxStackBuffer,
+                                                StaticTask_t * const pxTaskBuffer,
+                                                TickType_t xPeriod,
+                                                TickType_t xRelativeDeadline,
+                                                TickType_t xOffset,
+                                                TickType_t xWCET,
+                                                configRUN_TIME_COUNTER_TYPE ulBudget ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * freertos_tasks_c_additions_init() should only be called if the user definable
+ * macro FREERTOS_TASKS_C_ADDITIONS_INIT() is defined, as that is the only macro
+ * called by the function.
+ */
+#ifdef FREERTOS_TASKS_C_ADDITIONS_INIT
+
+    static void freertos_tasks_c_additions_init( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+    TaskHandle_t xTaskCreateStatic( TaskFunction_t pxTaskCode,
+                                    const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                    const uint32_t ulStackDepth,
+                                    void * const pvParameters,
+                                    UBaseType_t uxPriority,
+                                    StackType_t * const puxStackBuffer,
+                                    StaticTask_t * const pxTaskBuffer )
+    {
+        TCB_t * pxNewTCB;
+        TaskHandle_t xReturn;
+
+        configASSERT( puxStackBuffer != NULL );
+        configASSERT( pxTaskBuffer != NULL );
+
+        #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticTask_t equals the size of the real task
+                 * structure. */
+                volatile size_t xSize = sizeof( StaticTask_t );
+                configASSERT( xSize == sizeof( TCB_t ) );
+                ( void ) xSize; /* Prevent lint warning when configASSERT() is not used. */
+            }
+        #endif /* configASSERT_DEFINED */
+
+        if( ( pxTaskBuffer != NULL ) && ( puxStackBuffer != NULL ) )
+        {
+            /* The memory used for the task's TCB and stack are passed into this
+             * function - use them. */
+            pxNewTCB = ( TCB_t * ) pxTaskBuffer; /*lint !e740 !e9087 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+            pxNewTCB->pxStack = ( StackType_t * ) puxStackBuffer;
+
+            #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
+                {
+                    /* Tasks can be created statically or dynamically, so note this
+                     * task was created statically in case the task is later deleted. */
+                    pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_AND_TCB;
+                }
+            #endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+
+            prvInitialiseNewTask( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, &xReturn, pxNewTCB, NULL );
+            prvAddNewTaskToReadyList( pxNewTCB );
+        }
+        else
+        {
+            xReturn = NULL;
+        }
+
+        return xReturn;
+    }
+
+#endif /* SUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if ( ( portUSING_MPU_WRAPPERS == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+    BaseType_t xTaskCreateRestrictedStatic( const TaskParameters_t * const pxTaskDefinition,
+                                            TaskHandle_t * pxCreatedTask )
+    {
+        TCB_t * pxNewTCB;
+        BaseType_t xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+
+        configASSERT( pxTaskDefinition->puxStackBuffer != NULL );
+        configASSERT( pxTaskDefinition->pxTaskBuffer != NULL );
 
         if( ( pxTaskDefinition->puxStackBuffer != NULL ) && ( pxTaskDefinition->pxTaskBuffer != NULL ) )
         {
@@ -837,106 +1752,393 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 /* Create a periodic task, calculate task deadline and insert it in EDF ready tasks list */
 #if ( configUSE_EDF_SCHEDULER == 1 )
 	
-	/*E.C. */
-    BaseType_t xTaskPeriodicCreate( TaskFunction_t pxTaskCode,
-                            const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-                            const configSTACK_DEPTH_TYPE usStackDepth,
-                            void * const pvParameters,
-                            UBaseType_t uxPriority,
-                            TaskHandle_t * const pxCreatedTask,
-							TickType_t period )
+    static TCB_t * prvEDFCreateTask( TaskFunction_t pxTaskCode,
+                                     const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                     const uint32_t ulStackDepth,
+                                     void * const pvParameters,
+                                     UBaseType_t uxPriority,
+                                     TaskHandle_t * const pxCreatedTask,
+                                     StackType_t * const puxStackBuffer,
+                                     StaticTask_t * const pxTaskBuffer )
     {
-        TCB_t * pxNewTCB;
-        BaseType_t xReturn;
+        TCB_t * pxNewTCB = NULL;
 
-        /* If the stack grows down then allocate the stack then the TCB so the stack
-         * does not grow into the TCB.  Likewise if the stack grows up then allocate
-         * the TCB then the stack. */
-        #if ( portSTACK_GROWTH > 0 )
+        #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+            if( pxTaskBuffer != NULL )
             {
-                /* Allocate space for the TCB.  Where the memory comes from depends on
-                 * the implementation of the port malloc function and whether or not static
-                 * allocation is being used. */
-                pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+                #if ( configASSERT_DEFINED == 1 )
+                    {
+                        /* Sanity check that the size of the structure used to declare a
+                         * variable of type StaticTask_t equals the size of the real task
+                         * structure. */
+                        volatile size_t xSize = sizeof( StaticTask_t );
+                        configASSERT( xSize == sizeof( TCB_t ) );
+                        ( void ) xSize; /* Prevent lint warning when configASSERT() is not used. */
+                    }
+                #endif /* configASSERT_DEFINED */
 
-                if( pxNewTCB != NULL )
-                {
-                    /* Allocate space for the stack used by the task being created.
-                     * The base of the stack memory stored in the TCB so the task can
-                     * be deleted later if required. */
-                    pxNewTCB->pxStack = ( StackType_t * ) pvPortMallocStack( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                /* The memory used for the task's TCB and stack are passed into this
+                 * function - use them. */
+                pxNewTCB = ( TCB_t * ) pxTaskBuffer; /*lint !e740 !e9087 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+                pxNewTCB->pxStack = ( StackType_t * ) puxStackBuffer;
 
-                    if( pxNewTCB->pxStack == NULL )
+                #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e731 !e9029 Macro has been consolidated for readability reasons. */
                     {
-                        /* Could not allocate the stack.  Delete the allocated TCB. */
-                        vPortFree( pxNewTCB );
-                        pxNewTCB = NULL;
+                        /* Tasks can be created statically or dynamically, so note this
+                         * task was created statically in case the task is later deleted. */
+                        pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_AND_TCB;
                     }
-                }
+                #endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
             }
-        #else /* portSTACK_GROWTH */
-            {
-                StackType_t * pxStack;
-
-                /* Allocate space for the stack used by the task being created. */
-                pxStack = pvPortMallocStack( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation is the stack. */
-
-                if( pxStack != NULL )
+            else
+        #else /* configSUPPORT_STATIC_ALLOCATION */
+            ( void ) puxStackBuffer;
+            ( void ) pxTaskBuffer;
+        #endif /* configSUPPORT_STATIC_ALLOCATION */
+        {
+            #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
                 {
-                    /* Allocate space for the TCB. */
-                    pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of TCB_t is always a pointer to the task's stack. */
-
-                    if( pxNewTCB != NULL )
+                /* If the stack grows down then allocate the stack then the TCB so the stack
+                 * does not grow into the TCB.  Likewise if the stack grows up then allocate
+                 * the TCB then the stack. */
+                #if ( portSTACK_GROWTH > 0 )
                     {
-                        /* Store the stack location in the TCB. */
-                        pxNewTCB->pxStack = pxStack;
+                        /* Allocate space for the TCB.  Where the memory comes from depends on
+                         * the implementation of the port malloc function and whether or not static
+                         * allocation is being used. */
+                        pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+
+                        if( pxNewTCB != NULL )
+                        {
+                            /* Allocate space for the stack used by the task being created.
+                             * The base of the stack memory stored in the TCB so the task can
+                             * be deleted later if required. */
+                            pxNewTCB->pxStack = ( StackType_t * ) pvPortMallocStack( ( ( ( size_t ) ulStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+                            if( pxNewTCB->pxStack == NULL )
+                            {
+                                /* Could not allocate the stack.  Delete the allocated TCB. */
+                                vPortFree( pxNewTCB );
+                                pxNewTCB = NULL;
+                            }
+                        }
                     }
-                    else
+                #else /* portSTACK_GROWTH */
                     {
-                        /* The stack cannot be used as the TCB was not created.  Free
-                         * it again. */
-                        vPortFreeStack( pxStack );
+                        StackType_t * pxStack;
+
+                        /* Allocate space for the stack used by the task being created. */
+                        pxStack = pvPortMallocStack( ( ( ( size_t ) ulStackDepth ) * sizeof( StackType_t ) ) ); /*lint !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack and this allocation is the stack. */
+
+                        if( pxStack != NULL )
+                        {
+                            /* Allocate space for the TCB. */
+                            pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) ); /*lint !e9087 !e9079 All values returned by pvPortMalloc() have at least the alignment required by the MCU's stack, and the first member of TCB_t is always a pointer to the task's stack. */
+
+                            if( pxNewTCB != NULL )
+                            {
+                                /* Store the stack location in the TCB. */
+                                pxNewTCB->pxStack = pxStack;
+                            }
+                            else
+                            {
+                                /* The stack cannot be used as the TCB was not created.  Free
+                                 * it again. */
+                                vPortFreeStack( pxStack );
+                            }
+                        }
+                        else
+                        {
+                            pxNewTCB = NULL;
+                        }
                     }
+                #endif /* portSTACK_GROWTH */
+
+                    #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e9029 !e731 Macro has been consolidated for readability reasons. */
+                        {
+                            /* Tasks can be created statically or dynamically, so note this
+                             * task was created dynamically in case it is later deleted. */
+                            if( pxNewTCB != NULL )
+                            {
+                                pxNewTCB->ucStaticallyAllocated = tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB;
+                            }
+                        }
+                    #endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
                 }
-                else
-                {
-                    pxNewTCB = NULL;
-                }
-            }
-        #endif /* portSTACK_GROWTH */
+            #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+        }
 
         if( pxNewTCB != NULL )
         {
-            #if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 ) /*lint !e9029 !e731 Macro has been consolidated for readability reasons. */
-                {
-                    /* Tasks can be created statically or dynamically, so note this
-                     * task was created dynamically in case it is later deleted. */
-                    pxNewTCB->ucStaticallyAllocated = tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB;
-                }
-            #endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+            prvInitialiseNewTask( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
+        }
 
-            prvInitialiseNewTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
-        	
+        return pxNewTCB;
+    }
 
-			/*E.C. : initialize the period */
-			pxNewTCB->xTaskPeriod = period;
-			/*E.C. : insert the period value in the generic list iteam before to add the task in RL: */
-			listSET_LIST_ITEM_VALUE( &( ( pxNewTCB )->xStateListItem ), ( pxNewTCB )->xTaskPeriod + xTaskGetTickCount() );	
-			
+    static BaseType_t prvEDFCreatePeriodicTask( TaskFunction_t pxTaskCode,
+                                                const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                                                const uint32_t ulStackDepth,
+                                                void * const pvParameters,
+                                                UBaseType_t uxPriority,
+                                                TaskHandle_t * const pxCreatedTask,
+                                                StackType_t * const puxStackBuffer,
+                                                StaticTask_t * const pxTaskBuffer,
+                                                TickType_t period,
+                                                TickType_t relativeDeadline,
+                                                TickType_t offset,
+                                                TickType_t wcet,
+                                                configRUN_TIME_COUNTER_TYPE budget )
+    {
+        TCB_t * pxNewTCB = NULL;
+        BaseType_t xReturn = errTASK_NOT_ADMITTED;
+
+        configASSERT( period > 0U );
+        configASSERT( relativeDeadline > 0U );
+        configASSERT( wcet <= period );
+
+        /*E.C. : the scheduler stays suspended until the task is accounted
+         * for, so no other task is admitted against the same test */
+        #if ( configEDF_ADMISSION_CONTROL == 1 )
+            vTaskSuspendAll();
+        #else
+            ( void ) wcet;
+        #endif
+
+        if( taskEDF_DEADLINE_FITS( relativeDeadline ) == pdFALSE )
+        {
+            xReturn = errTASK_DEADLINE_OUT_OF_RANGE;
+        }
+        #if ( configEDF_ADMISSION_CONTROL == 1 )
+            else if( ( wcet == ( TickType_t ) 0U ) || ( prvEDFAdmissionTest( wcet, relativeDeadline, period ) != pdFALSE ) )
+        #else
+            else
+        #endif
+        {
+            pxNewTCB = prvEDFCreateTask( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, pxCreatedTask, puxStackBuffer, pxTaskBuffer );
+            xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+        }
 
-					
+        if( pxNewTCB != NULL )
+        {
+			/*E.C. : initialize the period, the relative deadline and the offset */
+			pxNewTCB->xTaskPeriod = period;
+			pxNewTCB->xTaskRelativeDeadline = relativeDeadline;
+			pxNewTCB->xTaskOffset = offset;
+			#if ( configEDF_BUDGET_ENFORCEMENT == 1 )
+				pxNewTCB->ulTaskBudget = budget;
+			#else
+				( void ) budget;
+			#endif
+			#if ( configEDF_ADMISSION_CONTROL == 1 )
+				pxNewTCB->xTaskWCET = wcet;
+				prvEDFAdmitTask( pxNewTCB );
+			#endif
+			/*E.C. : the first job is released now or after the offset, see prvAddNewTaskToReadyList() */
 			prvAddNewTaskToReadyList( pxNewTCB );
             
 			xReturn = pdPASS;
         }
         else
         {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        #if ( configEDF_ADMISSION_CONTROL == 1 )
+            ( void ) xTaskResumeAll();
+        #endif
+
+        return xReturn;
+    }
+
+	#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	/*E.C. : Each job of the task is due relativeDeadline ticks after its
+	 * release, which may be before or after the next release.  The first job
+	 * is released offset ticks after the task is created, until then the task
+	 * is blocked.  With configEDF_BUDGET_ENFORCEMENT each job may run for
+	 * budget run time counter units before it is throttled, 0 for no limit.
+	 * With configEDF_ADMISSION_CONTROL the task is only created if each job
+	 * running for wcet ticks keeps the task set schedulable. */
+    BaseType_t xTaskPeriodicCreateEx( TaskFunction_t pxTaskCode,
+                            const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                            const configSTACK_DEPTH_TYPE usStackDepth,
+                            void * const pvParameters,
+                            UBaseType_t uxPriority,
+                            TaskHandle_t * const pxCreatedTask,
+							TickType_t period,
+							TickType_t relativeDeadline,
+							TickType_t offset,
+							TickType_t wcet,
+							configRUN_TIME_COUNTER_TYPE budget )
+    {
+        return prvEDFCreatePeriodicTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, uxPriority, pxCreatedTask, NULL, NULL, period, relativeDeadline, offset, wcet, budget );
+    }
+
+	/*E.C. : The deadline of each job is the next release and the first job is
+	 * released straight away. */
+    BaseType_t xTaskPeriodicCreate( TaskFunction_t pxTaskCode,
+                            const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                            const configSTACK_DEPTH_TYPE usStackDepth,
+                            void * const pvParameters,
+                            UBaseType_t uxPriority,
+                            TaskHandle_t * const pxCreatedTask,
+							TickType_t period )
+    {
+        return xTaskPeriodicCreateEx( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, period, period, ( TickType_t ) 0U, ( TickType_t ) 0U, ( configRUN_TIME_COUNTER_TYPE ) 0 );
+    }
+
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+	#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	/*E.C. : As xTaskPeriodicCreateEx(), with the TCB and the stack in the
+	 * buffers passed in, as by xTaskCreateStatic(), so no heap is needed. */
+    BaseType_t xTaskPeriodicCreateStatic( TaskFunction_t pxTaskCode,
+                            const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                            const uint32_t ulStackDepth,
+                            void * const pvParameters,
+                            UBaseType_t uxPriority,
+                            StackType_t * const puxStackBuffer,
+                            StaticTask_t * const pxTaskBuffer,
+                            TaskHandle_t * const pxCreatedTask,
+							TickType_t period,
+							TickType_t relativeDeadline,
+							TickType_t offset,
+							TickType_t wcet,
+							configRUN_TIME_COUNTER_TYPE budget )
+    {
+        BaseType_t xReturn;
+
+        configASSERT( puxStackBuffer != NULL );
+        configASSERT( pxTaskBuffer != NULL );
+
+        if( ( pxTaskBuffer != NULL ) && ( puxStackBuffer != NULL ) )
+        {
+            xReturn = prvEDFCreatePeriodicTask( pxTaskCode, pcName, ulStackDepth, pvParameters, uxPriority, pxCreatedTask, puxStackBuffer, pxTaskBuffer, period, relativeDeadline, offset, wcet, budget );
+        }
+        else
+        {
+            xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+        }
+
+        return xReturn;
+    }
+
+	#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+	#if ( configEDF_JOB_CARRIERS > 0 )
+
+	/*E.C. : As xTaskPeriodicCreateStatic(), for a task whose jobs run to
+	 * completion.  pxJobCode is called once for each job and returns when the
+	 * job is done, with no loop and no xTaskWaitForNextPeriod() of its own.
+	 * The task only needs its TCB, its jobs run on the stacks of the job
+	 * carriers, see configEDF_JOB_CARRIERS.  It cannot be deleted. */
+    BaseType_t xTaskPeriodicJobCreateStatic( TaskFunction_t pxJobCode,
+                            const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                            void * const pvParameters,
+                            UBaseType_t uxPriority,
+                            StaticTask_t * const pxTaskBuffer,
+                            TaskHandle_t * const pxCreatedTask,
+							TickType_t period,
+							TickType_t relativeDeadline,
+							TickType_t offset,
+							TickType_t wcet,
+							configRUN_TIME_COUNTER_TYPE budget )
+    {
+        BaseType_t xReturn;
+
+        configASSERT( pxJobCode != NULL );
+        configASSERT( pxTaskBuffer != NULL );
+
+        if( pxTaskBuffer != NULL )
+        {
+            xReturn = prvEDFCreatePeriodicTask( pxJobCode, pcName, ( uint32_t ) 0U, pvParameters, uxPriority, pxCreatedTask, NULL, pxTaskBuffer, period, relativeDeadline, offset, wcet, budget );
+        }
+        else
+        {
+            xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+        }
+
+        return xReturn;
+    }
+
+	#endif /* configEDF_JOB_CARRIERS */
+
+	#if ( ( configUSE_EDF_SERVERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	/*E.C. : The task is served by a constant bandwidth server that lets it
+	 * run for budget ticks in every period ticks.  It has no jobs of its own,
+	 * it runs whenever it is ready, by the deadline of its server, so it can
+	 * be woken by an interrupt through a notification, a queue or a
+	 * semaphore rather than polling.  With configEDF_ADMISSION_CONTROL the
+	 * server is admitted as a task taking budget ticks in each period. */
+    BaseType_t xTaskServerCreate( TaskFunction_t pxTaskCode,
+                            const char * const pcName, /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+                            const configSTACK_DEPTH_TYPE usStackDepth,
+                            void * const pvParameters,
+                            UBaseType_t uxPriority,
+                            TaskHandle_t * const pxCreatedTask,
+							TickType_t budget,
+							TickType_t period )
+    {
+        TCB_t * pxNewTCB = NULL;
+        BaseType_t xReturn = errTASK_NOT_ADMITTED;
+
+        configASSERT( budget > 0U );
+        configASSERT( budget <= period );
+
+        #if ( configEDF_ADMISSION_CONTROL == 1 )
+            vTaskSuspendAll();
+        #endif
+
+        /* The deadlines of the server are a period apart. */
+        if( taskEDF_DEADLINE_FITS( period ) == pdFALSE )
+        {
+            xReturn = errTASK_DEADLINE_OUT_OF_RANGE;
+        }
+        #if ( configEDF_ADMISSION_CONTROL == 1 )
+            else if( prvEDFAdmissionTest( budget, period, period ) != pdFALSE )
+        #else
+            else
+        #endif
+        {
+            pxNewTCB = prvEDFCreateTask( pxTaskCode, pcName, ( uint32_t ) usStackDepth, pvParameters, uxPriority, pxCreatedTask, NULL, NULL );
             xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
         }
 
+        if( pxNewTCB != NULL )
+        {
+			/*E.C. : the server starts idle with a full budget, so the task is
+			 * added as a new arrival and gets its first deadline from there */
+			pxNewTCB->xTaskPeriod = period;
+			pxNewTCB->xServerBudget = budget;
+			pxNewTCB->xServerCapacity = budget;
+			pxNewTCB->xServerDeadline = xTaskGetTickCount();
+			pxNewTCB->ucServerIdle = ( uint8_t ) pdTRUE;
+			#if ( configEDF_ADMISSION_CONTROL == 1 )
+				pxNewTCB->xTaskWCET = budget;
+				prvEDFAdmitTask( pxNewTCB );
+			#endif
+
+			prvAddNewTaskToReadyList( pxNewTCB );
+
+			xReturn = pdPASS;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        #if ( configEDF_ADMISSION_CONTROL == 1 )
+            ( void ) xTaskResumeAll();
+        #endif
+
         return xReturn;
     }
 
+	#endif /* ( configUSE_EDF_SERVERS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+
 #endif /* configUSE_EDF_SCHEDULER */
 /*-----------------------------------------------------------*/
 
@@ -971,7 +2173,10 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
     #if ( tskSET_NEW_STACKS_TO_KNOWN_VALUE == 1 )
         {
             /* Fill the stack with a known value to assist debugging. */
-            ( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
+            if( taskEDF_HAS_OWN_STACK( pxNewTCB ) )
+            {
+                ( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) ulStackDepth * sizeof( StackType_t ) );
+            }
         }
     #endif /* tskSET_NEW_STACKS_TO_KNOWN_VALUE */
 
@@ -979,34 +2184,49 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
      * grows from high memory to low (as per the 80x86) or vice versa.
      * portSTACK_GROWTH is used to make the result positive or negative as required
      * by the port. */
-    #if ( portSTACK_GROWTH < 0 )
-        {
-            pxTopOfStack = &( pxNewTCB->pxStack[ ulStackDepth - ( uint32_t ) 1 ] );
-            pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 !e9033 !e9078 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type.  Checked by assert(). */
+    if( taskEDF_HAS_OWN_STACK( pxNewTCB ) )
+    {
+        #if ( portSTACK_GROWTH < 0 )
+            {
+                pxTopOfStack = &( pxNewTCB->pxStack[ ulStackDepth - ( uint32_t ) 1 ] );
+                pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) ); /*lint !e923 !e9033 !e9078 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type.  Checked by assert(). */
 
-            /* Check the alignment of the calculated top of stack is correct. */
-            configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+                /* Check the alignment of the calculated top of stack is correct. */
+                configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
 
-            #if ( configRECORD_STACK_HIGH_ADDRESS == 1 )
-                {
-                    /* Also record the stack's high address, which may assist
-                     * debugging. */
-                    pxNewTCB->pxEndOfStack = pxTopOfStack;
-                }
-            #endif /* configRECORD_STACK_HIGH_ADDRESS */
-        }
-    #else /* portSTACK_GROWTH */
-        {
-            pxTopOfStack = pxNewTCB->pxStack;
+                #if ( configRECORD_STACK_HIGH_ADDRESS == 1 )
+                    {
+                        /* Also record the stack's high address, which may assist
+                         * debugging. */
+                        pxNewTCB->pxEndOfStack = pxTopOfStack;
+                    }
+                #endif /* configRECORD_STACK_HIGH_ADDRESS */
+            }
+        #else /* portSTACK_GROWTH */
+            {
+                pxTopOfStack = pxNewTCB->pxStack;
 
-            /* Check the alignment of the stack buffer is correct. */
-            configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxNewTCB->pxStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+                /* Check the alignment of the stack buffer is correct. */
+                configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxNewTCB->pxStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
 
-            /* The other extreme of the stack space is required if stack checking is
-             * performed. */
-            pxNewTCB->pxEndOfStack = pxNewTCB->pxStack + ( ulStackDepth - ( uint32_t ) 1 );
-        }
-    #endif /* portSTACK_GROWTH */
+                /* The other extreme of the stack space is required if stack checking is
+                 * performed. */
+                pxNewTCB->pxEndOfStack = pxNewTCB->pxStack + ( ulStackDepth - ( uint32_t ) 1 );
+            }
+        #endif /* portSTACK_GROWTH */
+    }
+    else
+    {
+        /* E.C. : A job task is given the stack of a carrier for each job,
+         * see prvEDFBindJobCarrier(). */
+        pxTopOfStack = NULL;
+
+        #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
+            {
+                pxNewTCB->pxEndOfStack = NULL;
+            }
+        #endif
+    }
 
     /* Store the task name in the TCB. */
     if( pcName != NULL )
@@ -1062,6 +2282,74 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
     vListInitialiseItem( &( pxNewTCB->xStateListItem ) );
     vListInitialiseItem( &( pxNewTCB->xEventListItem ) );
 
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_BINARY_HEAP ) )
+        {
+            pxNewTCB->uxEDFHeapIndex = ( UBaseType_t ) 0U;
+        }
+    #endif
+
+    /* E.C. : A task that is not periodic, such as the idle task, has no
+     * period and its deadline is the tick it was created on.
+     * xTaskPeriodicCreateEx() sets them for a periodic task. */
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        {
+            pxNewTCB->xTaskPeriod = ( TickType_t ) 0U;
+            pxNewTCB->xTaskRelativeDeadline = ( TickType_t ) 0U;
+            pxNewTCB->xTaskOffset = ( TickType_t ) 0U;
+            pxNewTCB->xTaskDeadline = xTickCount;
+            pxNewTCB->xTaskRelease = xTickCount;
+            pxNewTCB->uxDeadlineMisses = ( UBaseType_t ) 0U;
+            pxNewTCB->xMaxLateness = ( TickType_t ) 0U;
+            pxNewTCB->ucEDFJobState = taskEDF_JOB_ACTIVE;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_MUTEXES == 1 ) )
+        {
+            pxNewTCB->xInheritedDeadline = ( TickType_t ) 0U;
+            pxNewTCB->ucDeadlineInherited = ( uint8_t ) pdFALSE;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) )
+        {
+            pxNewTCB->uxSRPResourcesHeld = ( UBaseType_t ) 0U;
+        }
+    #endif
+
+    /* E.C. : A task created without a stack is a job task, which runs
+     * pxTaskCode once for each job on a carrier. */
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_JOB_CARRIERS > 0 ) )
+        {
+            pxNewTCB->pxJobCode = ( pxNewTCB->pxStack == NULL ) ? pxTaskCode : NULL;
+            pxNewTCB->pvJobParameters = pvParameters;
+            pxNewTCB->pxJobCarrier = NULL;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_ADMISSION_CONTROL == 1 ) )
+        {
+            pxNewTCB->xTaskWCET = ( TickType_t ) 0U;
+            pxNewTCB->pxEDFNextAdmitted = NULL;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SERVERS == 1 ) )
+        {
+            pxNewTCB->xServerBudget = ( TickType_t ) 0U;
+            pxNewTCB->xServerCapacity = ( TickType_t ) 0U;
+            pxNewTCB->xServerDeadline = ( TickType_t ) 0U;
+            pxNewTCB->ucServerIdle = ( uint8_t ) pdFALSE;
+        }
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_BUDGET_ENFORCEMENT == 1 ) )
+        {
+            pxNewTCB->ulTaskBudget = ( configRUN_TIME_COUNTER_TYPE ) 0;
+            pxNewTCB->ulJobRunTime = ( configRUN_TIME_COUNTER_TYPE ) 0;
+        }
+    #endif
+
     /* Set the pxNewTCB as a link back from the ListItem_t.  This is so we can get
      * back to  the containing TCB from a generic item in a list. */
     listSET_LIST_ITEM_OWNER( &( pxNewTCB->xStateListItem ), pxNewTCB );
@@ -1131,75 +2419,96 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
      * but had been interrupted by the scheduler.  The return address is set
      * to the start of the task function. Once the stack has been initialised
      * the top of stack variable is updated. */
-    #if ( portUSING_MPU_WRAPPERS == 1 )
-        {
-            /* If the port has capability to detect stack overflow,
-             * pass the stack end address to the stack initialization
-             * function as well. */
-            #if ( portHAS_STACK_OVERFLOW_CHECKING == 1 )
-                {
-                    #if ( portSTACK_GROWTH < 0 )
-                        {
-                            pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters, xRunPrivileged );
-                        }
-                    #else /* portSTACK_GROWTH */
-                        {
-                            pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters, xRunPrivileged );
-                        }
-                    #endif /* portSTACK_GROWTH */
-                }
-            #else /* portHAS_STACK_OVERFLOW_CHECKING */
-                {
-                    pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters, xRunPrivileged );
-                }
-            #endif /* portHAS_STACK_OVERFLOW_CHECKING */
-        }
-    #else /* portUSING_MPU_WRAPPERS */
-        {
-            /* If the port has capability to detect stack overflow,
-             * pass the stack end address to the stack initialization
-             * function as well. */
-            #if ( portHAS_STACK_OVERFLOW_CHECKING == 1 )
-                {
-                    #if ( portSTACK_GROWTH < 0 )
-                        {
-                            pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters );
-                        }
-                    #else /* portSTACK_GROWTH */
-                        {
-                            pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters );
-                        }
-                    #endif /* portSTACK_GROWTH */
-                }
-            #else /* portHAS_STACK_OVERFLOW_CHECKING */
-                {
-                    pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters );
-                }
-            #endif /* portHAS_STACK_OVERFLOW_CHECKING */
-        }
-    #endif /* portUSING_MPU_WRAPPERS */
-
-    if( pxCreatedTask != NULL )
-    {
-        /* Pass the handle out in an anonymous way.  The handle can be used to
-         * change the created task's priority, delete the created task, etc.*/
-        *pxCreatedTask = ( TaskHandle_t ) pxNewTCB;
-    }
-    else
+    if( taskEDF_HAS_OWN_STACK( pxNewTCB ) )
     {
-        mtCOVERAGE_TEST_MARKER();
-    }
-}
+        #if ( portUSING_MPU_WRAPPERS == 1 )
+            {
+                /* If the port has capability to detect stack overflow,
+                 * pass the stack end address to the stack initialization
+                 * function as well. */
+                #if ( portHAS_STACK_OVERFLOW_CHECKING == 1 )
+                    {
+                        #if ( portSTACK_GROWTH < 0 )
+                            {
+                                pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters, xRunPrivileged );
+                            }
+                        #else /* portSTACK_GROWTH */
+                            {
+                                pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters, xRunPrivileged );
+                            }
+                        #endif /* portSTACK_GROWTH */
+                    }
+                #else /* portHAS_STACK_OVERFLOW_CHECKING */
+                    {
+                        pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters, xRunPrivileged );
+                    }
+                #endif /* portHAS_STACK_OVERFLOW_CHECKING */
+            }
+        #else /* portUSING_MPU_WRAPPERS */
+            {
+                /* If the port has capability to detect stack overflow,
+                 * pass the stack end address to the stack initialization
+                 * function as well. */
+                #if ( portHAS_STACK_OVERFLOW_CHECKING == 1 )
+                    {
+                        #if ( portSTACK_GROWTH < 0 )
+                            {
+                                pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxStack, pxTaskCode, pvParameters );
+                            }
+                        #else /* portSTACK_GROWTH */
+                            {
+                                pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxNewTCB->pxEndOfStack, pxTaskCode, pvParameters );
+                            }
+                        #endif /* portSTACK_GROWTH */
+                    }
+                #else /* portHAS_STACK_OVERFLOW_CHECKING */
+                    {
+                        pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters );
+                    }
+                #endif /* portHAS_STACK_OVERFLOW_CHECKING */
+            }
+        #endif /* portUSING_MPU_WRAPPERS */
+    }
+    else
+    {
+        /* E.C. : The context of a job is set up on its carrier. */
+        pxNewTCB->pxTopOfStack = NULL;
+    }
+
+    if( pxCreatedTask != NULL )
+    {
+        /* Pass the handle out in an anonymous way.  The handle can be used to
+         * change the created task's priority, delete the created task, etc.*/
+        *pxCreatedTask = ( TaskHandle_t ) pxNewTCB;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
 /*-----------------------------------------------------------*/
 
 static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 {
+    /* E.C. : A task created with an offset is not queued yet. */
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        BaseType_t xQueued = pdFALSE;
+    #endif
+
     /* Ensure interrupts don't access the task lists while the lists are being
      * updated. */
     taskENTER_CRITICAL();
     {
         uxCurrentNumberOfTasks++;
 
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_BINARY_HEAP ) )
+            {
+                /* E.C. : Caught here rather than when the heap fills up on
+                 * some later release. */
+                configASSERT( uxCurrentNumberOfTasks <= ( UBaseType_t ) configEDF_READY_HEAP_LENGTH );
+            }
+        #endif
+
         if( pxCurrentTCB == NULL )
         {
             /* There are no other tasks, or all the other tasks are in
@@ -1250,7 +2559,26 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
         #endif /* configUSE_TRACE_FACILITY */
         traceTASK_CREATE( pxNewTCB );
 
-        prvAddTaskToReadyList( pxNewTCB );
+        /* E.C. : A task created with an offset is blocked until its first
+         * job is released, as if its job before had completed. */
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                if( pxNewTCB->xTaskOffset != ( TickType_t ) 0U )
+                {
+                    pxNewTCB->ucEDFJobState = taskEDF_JOB_DONE;
+                    prvEDFAddTaskToDelayedList( pxNewTCB, xTickCount + pxNewTCB->xTaskOffset );
+                }
+                else
+                {
+                    prvEDFReleaseJob( pxNewTCB, xTickCount );
+                    xQueued = prvAddUnblockedTaskToReadyList( pxNewTCB );
+                }
+            }
+        #else
+            {
+                prvAddTaskToReadyList( pxNewTCB );
+            }
+        #endif
 
         portSETUP_TCB( pxNewTCB );
     }
@@ -1259,8 +2587,13 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
     if( xSchedulerRunning != pdFALSE )
     {
         /* If the created task is of a higher priority than the current task
-         * then it should run now. */
-        if( pxCurrentTCB->uxPriority < pxNewTCB->uxPriority )
+         * then it should run now.  E.C. : Under EDF if it has the earlier
+         * deadline, unless it is not ready yet. */
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            if( ( xQueued != pdFALSE ) && ( taskEDF_PREEMPTS_CURRENT( pxNewTCB ) != pdFALSE ) )
+        #else
+            if( pxCurrentTCB->uxPriority < pxNewTCB->uxPriority )
+        #endif
         {
             taskYIELD_IF_USING_PREEMPTION();
         }
@@ -1288,6 +2621,14 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
              * being deleted. */
             pxTCB = prvGetTCBFromHandle( xTaskToDelete );
 
+            /* E.C. : A job task has no context of its own for the port to
+             * clean up, its jobs run on carriers that are never deleted. */
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_JOB_CARRIERS > 0 ) )
+                {
+                    configASSERT( pxTCB->pxJobCode == NULL );
+                }
+            #endif
+
             /* Remove task from the ready/delayed list. */
             if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
             {
@@ -1298,6 +2639,21 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 mtCOVERAGE_TEST_MARKER();
             }
 
+            /* E.C. : The heap must not keep a reference to a TCB that is
+             * about to be freed. */
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_BINARY_HEAP ) )
+                {
+                    prvEDFHeapRemove( pxTCB );
+                }
+            #endif
+
+            /* E.C. : The processor time of the task is free for new tasks. */
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_ADMISSION_CONTROL == 1 ) )
+                {
+                    prvEDFWithdrawTask( pxTCB );
+                }
+            #endif
+
             /* Is the task waiting on an event also? */
             if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
             {
@@ -1399,6 +2755,16 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
             /* Generate the tick time at which the task wants to wake. */
             xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
 
+            /* E.C. : A periodic task completes its job here as it does in
+             * xTaskWaitForNextPeriod(), and its next job is released at the
+             * time to wake, which the deadline of that job is taken from. */
+            #if ( configUSE_EDF_SCHEDULER == 1 )
+                if( pxCurrentTCB->xTaskPeriod > 0U )
+                {
+                    xShouldDelay = prvEDFCompleteJob( &xTimeToWake, xConstTickCount );
+                }
+                else
+            #endif
             if( xConstTickCount < *pxPreviousWakeTime )
             {
                 /* The tick count has overflowed since this function was
@@ -1433,6 +2799,14 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
             /* Update the wake time ready for the next call. */
             *pxPreviousWakeTime = xTimeToWake;
 
+            #if ( configUSE_EDF_SCHEDULER == 1 )
+                if( pxCurrentTCB->xTaskPeriod > 0U )
+                {
+                    /* Blocked or released already. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+                else
+            #endif
             if( xShouldDelay != pdFALSE )
             {
                 traceTASK_DELAY_UNTIL( xTimeToWake );
@@ -1465,6 +2839,247 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 #endif /* INCLUDE_xTaskDelayUntil */
 /*-----------------------------------------------------------*/
 
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( INCLUDE_xTaskDelayUntil == 1 ) )
+
+    /* E.C. : The job of the calling task completes and the task blocks until
+     * the release of its next job, one period after the release of this one.
+     * Only here and in xTaskDelayUntil() does a job complete, a task that
+     * blocks anywhere else is still running its job when it wakes.  A task
+     * without jobs, one created by xTaskCreate() or xTaskServerCreate(), has
+     * no period to wait for. */
+    BaseType_t xTaskWaitForNextPeriod( void )
+    {
+        TickType_t xNextRelease;
+        BaseType_t xAlreadyYielded, xShouldDelay;
+
+        configASSERT( pxCurrentTCB->xTaskPeriod > 0U );
+        configASSERT( pxCurrentTCB->xTaskRelativeDeadline > 0U );
+        configASSERT( uxSchedulerSuspended == 0 );
+
+        vTaskSuspendAll();
+        {
+            xNextRelease = pxCurrentTCB->xTaskRelease + pxCurrentTCB->xTaskPeriod;
+            xShouldDelay = prvEDFCompleteJob( &xNextRelease, xTickCount );
+        }
+        xAlreadyYielded = xTaskResumeAll();
+
+        /* The task either blocked or now runs by a later deadline, so another
+         * task may be due to run. */
+        if( xAlreadyYielded == pdFALSE )
+        {
+            portYIELD_WITHIN_API();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xShouldDelay;
+    }
+    /*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFCompleteJob( TickType_t * const pxNextRelease,
+                                         const TickType_t xConstTickCount )
+    {
+        BaseType_t xShouldDelay;
+
+        /* A task woken early, by xTaskAbortDelay(), has no job to
+         * complete and waits again for the release it missed. */
+        if( ( pxCurrentTCB->ucEDFJobState != taskEDF_JOB_DONE ) &&
+            ( prvEDFCheckDeadline( pxCurrentTCB, xConstTickCount ) != pdFALSE ) )
+        {
+            #if ( configEDF_DEADLINE_MISS_POLICY == tskEDF_DEADLINE_MISS_SKIP_NEXT )
+                {
+                    *pxNextRelease += pxCurrentTCB->xTaskPeriod;
+                }
+            #endif
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxCurrentTCB->ucEDFJobState = taskEDF_JOB_DONE;
+
+        if( taskEDF_DEADLINE_BEFORE( xConstTickCount, *pxNextRelease ) != pdFALSE )
+        {
+            xShouldDelay = pdTRUE;
+            traceTASK_DELAY_UNTIL( *pxNextRelease );
+            prvAddCurrentTaskToDelayedList( *pxNextRelease - xConstTickCount, pdFALSE );
+        }
+        else
+        {
+            /* The task is late and its next job was released already,
+             * so it starts now, by the deadline it would have had from
+             * the tick. */
+            xShouldDelay = pdFALSE;
+            prvEDFReleaseJob( pxCurrentTCB, *pxNextRelease );
+            prvEDFSetReadyTaskDeadline( pxCurrentTCB, pxCurrentTCB->xTaskDeadline );
+
+            /* Under SRP the new job waits for the system ceiling like a
+             * job released by the tick. */
+            #if ( configUSE_EDF_SRP == 1 )
+                {
+                    if( taskEDF_PREEMPTION_LEVEL( pxCurrentTCB ) >= xEDFSystemCeiling )
+                    {
+                        ( void ) uxListRemove( &( pxCurrentTCB->xStateListItem ) );
+                        ( void ) prvEDFSRPHoldJob( pxCurrentTCB );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif
+
+            /* The task has run on since it was switched in, and only
+             * what it runs from here on belongs to the new job.  The
+             * charge at its next switch out covers the whole time, so the
+             * job starts that far below zero, modulo the counter range. */
+            #if ( configEDF_BUDGET_ENFORCEMENT == 1 )
+                {
+                    configRUN_TIME_COUNTER_TYPE ulRunTimeNow;
+
+                    taskEDF_GET_RUN_TIME_COUNTER_VALUE( ulRunTimeNow );
+                    pxCurrentTCB->ulJobRunTime = ulTaskSwitchedInTime - ulRunTimeNow;
+                }
+            #endif
+        }
+
+        return xShouldDelay;
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( INCLUDE_xTaskDelayUntil == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) )
+
+    /* E.C. : Declare that xTask uses SRP resource uxResource, which raises
+     * the ceiling of the resource to the preemption level of the task.  Every
+     * task using a resource must be declared before it first takes it. */
+    void vTaskSRPUseResource( TaskHandle_t xTask,
+                              UBaseType_t uxResource )
+    {
+        TCB_t * pxTCB = prvGetTCBFromHandle( xTask );
+
+        configASSERT( uxResource < ( UBaseType_t ) configEDF_SRP_RESOURCES );
+
+        /* A task without jobs has no preemption level. */
+        configASSERT( taskEDF_PREEMPTION_LEVEL( pxTCB ) != ( TickType_t ) 0U );
+
+        taskENTER_CRITICAL();
+        {
+            if( taskEDF_PREEMPTION_LEVEL( pxTCB ) < xEDFSRPResources[ uxResource ].xCeiling )
+            {
+                xEDFSRPResources[ uxResource ].xCeiling = taskEDF_PREEMPTION_LEVEL( pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    /* E.C. : Take SRP resource uxResource.  The job could only start once
+     * the system ceiling was below its level, so the resource is free and
+     * the call never blocks. */
+    void vTaskSRPLock( UBaseType_t uxResource )
+    {
+        EDFResource_t * pxResource;
+
+        configASSERT( uxResource < ( UBaseType_t ) configEDF_SRP_RESOURCES );
+        pxResource = &( xEDFSRPResources[ uxResource ] );
+
+        taskENTER_CRITICAL();
+        {
+            configASSERT( pxResource->pxHolder == NULL );
+
+            pxResource->pxHolder = pxCurrentTCB;
+            pxResource->xPreviousCeiling = xEDFSystemCeiling;
+            pxResource->uxDepth = uxEDFSRPLocked;
+            uxEDFSRPLocked++;
+            ( pxCurrentTCB->uxSRPResourcesHeld )++;
+
+            if( pxResource->xCeiling < xEDFSystemCeiling )
+            {
+                xEDFSystemCeiling = pxResource->xCeiling;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+    /* E.C. : Give back SRP resource uxResource, the last one taken.  The
+     * jobs held back by the ceiling it raised become ready, and the caller is
+     * preempted if one of them has an earlier deadline. */
+    void vTaskSRPUnlock( UBaseType_t uxResource )
+    {
+        EDFResource_t * pxResource;
+        TCB_t * pxTCB;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        configASSERT( uxResource < ( UBaseType_t ) configEDF_SRP_RESOURCES );
+        pxResource = &( xEDFSRPResources[ uxResource ] );
+
+        taskENTER_CRITICAL();
+        {
+            configASSERT( pxResource->pxHolder == pxCurrentTCB );
+            configASSERT( pxResource->uxDepth == ( uxEDFSRPLocked - ( UBaseType_t ) 1U ) );
+
+            pxResource->pxHolder = NULL;
+            uxEDFSRPLocked--;
+            ( pxCurrentTCB->uxSRPResourcesHeld )--;
+            xEDFSystemCeiling = pxResource->xPreviousCeiling;
+
+            while( listLIST_IS_EMPTY( &xEDFSRPHeldTasksList ) == pdFALSE )
+            {
+                pxTCB = listGET_OWNER_OF_HEAD_ENTRY( &xEDFSRPHeldTasksList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+                if( taskEDF_PREEMPTION_LEVEL( pxTCB ) >= xEDFSystemCeiling )
+                {
+                    /* The list is in level order, so the jobs left are
+                     * still held back. */
+                    break;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                prvAddTaskToReadyList( pxTCB );
+
+                if( taskEDF_PREEMPTS_CURRENT( pxTCB ) != pdFALSE )
+                {
+                    xYieldRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xYieldRequired != pdFALSE )
+        {
+            taskYIELD_IF_USING_PREEMPTION();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) */
+/*-----------------------------------------------------------*/
+
 #if ( INCLUDE_vTaskDelay == 1 )
 
     void vTaskDelay( const TickType_t xTicksToDelay )
@@ -1530,8 +3145,20 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
             taskENTER_CRITICAL();
             {
                 pxStateList = listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
-                pxDelayedList = pxDelayedTaskList;
-                pxOverflowedDelayedList = pxOverflowDelayedTaskList;
+
+                #if ( configEDF_DELAYED_WHEEL_SLOTS > 0 )
+                    {
+                        /* E.C. : A task on the wheel is in the slot of its wake
+                         * time. */
+                        pxDelayedList = &( xEDFDelayedWheel[ taskEDF_WHEEL_SLOT_OF( listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) ) ) ] );
+                        pxOverflowedDelayedList = &xEDFDelayedFarList;
+                    }
+                #else
+                    {
+                        pxDelayedList = pxDelayedTaskList;
+                        pxOverflowedDelayedList = pxOverflowDelayedTaskList;
+                    }
+                #endif
             }
             taskEXIT_CRITICAL();
 
@@ -1777,8 +3404,10 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 #endif /* if ( configUSE_MUTEXES == 1 ) */
 
                 /* Only reset the event list item value if the value is not
-                 * being used for anything else. */
-                if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+                 * being used for anything else.  E.C. : Under EDF it is the
+                 * deadline of the task, see vTaskPlaceOnEventList(). */
+                if( ( configUSE_EDF_SCHEDULER == 0 ) &&
+                    ( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL ) )
                 {
                     listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
                 }
@@ -1847,6 +3476,14 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
              * being suspended. */
             pxTCB = prvGetTCBFromHandle( xTaskToSuspend );
 
+            /* E.C. : A job that has started would keep its carrier for as
+             * long as it is suspended. */
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_JOB_CARRIERS > 0 ) )
+                {
+                    configASSERT( pxTCB->pxJobCarrier == NULL );
+                }
+            #endif
+
             traceTASK_SUSPEND( pxTCB );
 
             /* Remove task from the ready/delayed list and place in the
@@ -1872,6 +3509,21 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
 
             vListInsertEnd( &xSuspendedTaskList, &( pxTCB->xStateListItem ) );
 
+            /* E.C. : Work left pending on a suspended server is dropped, the
+             * task is an arrival once it is resumed. */
+            #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SERVERS == 1 ) )
+                {
+                    if( pxTCB->xServerBudget != ( TickType_t ) 0U )
+                    {
+                        pxTCB->ucServerIdle = ( uint8_t ) pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            #endif
+
             #if ( configUSE_TASK_NOTIFICATIONS == 1 )
                 {
                     BaseType_t x;
@@ -1993,6 +3645,10 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
     {
         TCB_t * const pxTCB = xTaskToResume;
 
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            BaseType_t xQueued;
+        #endif
+
         /* It does not make sense to resume the calling task. */
         configASSERT( xTaskToResume );
 
@@ -2009,10 +3665,23 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                     /* The ready list can be accessed even if the scheduler is
                      * suspended because this is inside a critical section. */
                     ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
+
+                    #if ( configUSE_EDF_SCHEDULER == 1 )
+                        {
+                            xQueued = prvAddUnblockedTaskToReadyList( pxTCB );
+                        }
+                    #else
+                        {
+                            prvAddTaskToReadyList( pxTCB );
+                        }
+                    #endif
 
                     /* A higher priority task may have just been resumed. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    #if ( configUSE_EDF_SCHEDULER == 1 )
+                        if( ( xQueued != pdFALSE ) && ( taskEDF_PREEMPTS_CURRENT( pxTCB ) != pdFALSE ) )
+                    #else
+                        if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    #endif
                     {
                         /* This yield may not cause the task just resumed to run,
                          * but will leave the lists in the correct state for the
@@ -2049,6 +3718,10 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
         TCB_t * const pxTCB = xTaskToResume;
         UBaseType_t uxSavedInterruptStatus;
 
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            BaseType_t xQueued;
+        #endif
+
         configASSERT( xTaskToResume );
 
         /* RTOS ports that support interrupt nesting have the concept of a
@@ -2079,23 +3752,37 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
                 if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
                 {
                     /* Ready lists can be accessed so move the task from the
-                     * suspended list to the ready list directly. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
-                    {
-                        xYieldRequired = pdTRUE;
+                     * suspended list to the ready list directly.  E.C. : It is
+                     * queued first, as under SRP it may be held back instead. */
+                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
 
-                        /* Mark that a yield is pending in case the user is not
-                         * using the return value to initiate a context switch
-                         * from the ISR using portYIELD_FROM_ISR. */
+                    #if ( configUSE_EDF_SCHEDULER == 1 )
+                        {
+                            xQueued = prvAddUnblockedTaskToReadyList( pxTCB );
+                        }
+                    #else
+                        {
+                            prvAddTaskToReadyList( pxTCB );
+                        }
+                    #endif
+
+                    #if ( configUSE_EDF_SCHEDULER == 1 )
+                        if( ( xQueued != pdFALSE ) && ( taskEDF_PREEMPTS_CURRENT( pxTCB ) != pdFALSE ) )
+                    #else
+                        if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    #endif
+                    {
+                        xYieldRequired = pdTRUE;
+
+                        /* Mark that a yield is pending in case the user is not
+                         * using the return value to initiate a context switch
+                         * from the ISR using portYIELD_FROM_ISR. */
                         xYieldPending = pdTRUE;
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
-
-                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
                 }
                 else
                 {
@@ -2151,31 +3838,69 @@ void vTaskStartScheduler( void )
         }
     #else /* if ( configSUPPORT_STATIC_ALLOCATION == 1 ) */
         {
-			/*E.C. : */
-			#if (configUSE_EDF_SCHEDULER == 1)
-			{
-				TickType_t initIDLEPeriod = 200;
-				xReturn = xTaskPeriodicCreate( 	prvIdleTask, "IDLE",
-									configMINIMAL_STACK_SIZE, 
-									(void * ) NULL, 
-									portPRIVILEGE_BIT,
-									&xIdleTaskHandle,
-									initIDLEPeriod );
-			}
-			#else
-            {
             /* The Idle task is being created using dynamically allocated RAM. */
-				xReturn = xTaskCreate( prvIdleTask,
+            xReturn = xTaskCreate( prvIdleTask,
                                    configIDLE_TASK_NAME,
                                    configMINIMAL_STACK_SIZE,
                                    ( void * ) NULL,
                                    portPRIVILEGE_BIT,  /* In effect ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), but tskIDLE_PRIORITY is zero. */
                                    &xIdleTaskHandle ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
-			}
-			#endif
-		}
+        }
     #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+    /* E.C. : The idle task has no deadline, so rather than holding a slot in
+     * the EDF ready queue it moves for good to the ready list of the idle
+     * priority, which EDF leaves unused otherwise.  The scheduler selects it
+     * only when the EDF ready queue is empty, so it needs no deadline and
+     * never touches the queue again. */
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        {
+            #if ( configEDF_JOB_CARRIERS > 0 )
+                {
+                    prvEDFInitialiseJobCarriers();
+                }
+            #endif
+
+            if( xReturn == pdPASS )
+            {
+                taskENTER_CRITICAL();
+                {
+                    #if ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_BINARY_HEAP )
+                        {
+                            ( void ) uxListRemove( &( xIdleTaskHandle->xStateListItem ) );
+                            prvEDFHeapRemove( xIdleTaskHandle );
+                        }
+                    #elif ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_DEADLINE_BUCKETS )
+                        {
+                            prvEDFBucketRemove( xIdleTaskHandle );
+                        }
+                    #else
+                        {
+                            ( void ) uxListRemove( &( xIdleTaskHandle->xStateListItem ) );
+                        }
+                    #endif
+
+                    listINSERT_END( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ), &( xIdleTaskHandle->xStateListItem ) );
+
+                    /* The first task to run is the one with the earliest
+                     * deadline, not the one created at the highest priority. */
+                    taskSELECT_EARLIEST_DEADLINE_TASK();
+
+                    #if ( configEDF_JOB_CARRIERS > 0 )
+                        {
+                            prvEDFBindJobCarrier();
+                        }
+                    #endif
+                }
+                taskEXIT_CRITICAL();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif /* configUSE_EDF_SCHEDULER */
+
     #if ( configUSE_TIMERS == 1 )
         {
             if( xReturn == pdPASS )
@@ -2221,6 +3946,13 @@ void vTaskStartScheduler( void )
         xSchedulerRunning = pdTRUE;
         xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
 
+        /* E.C. : Tasks created with an offset are blocked already. */
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                prvResetNextTaskUnblockTime();
+            }
+        #endif
+
         /* If configGENERATE_RUN_TIME_STATS is defined then the following
          * macro must be defined to configure the timer/counter used to generate
          * the run time counter time base.   NOTE:  If configGENERATE_RUN_TIME_STATS
@@ -2298,6 +4030,24 @@ void vTaskSuspendAll( void )
     static TickType_t prvGetExpectedIdleTime( void )
     {
         TickType_t xReturn;
+
+        /* E.C. : Under EDF all tasks share one ready queue whatever their
+         * priority, so the tick can only be suppressed while the idle task is
+         * the sole ready task.  The next release, held in xNextTaskUnblockTime,
+         * then bounds the sleep; no deadline can fall due before it as no job
+         * is pending. */
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                if( ( pxCurrentTCB != xIdleTaskHandle ) || ( prvEDFOnlyIdleTaskReady() == pdFALSE ) )
+                {
+                    xReturn = 0;
+                }
+                else
+                {
+                    xReturn = xNextTaskUnblockTime - xTickCount;
+                }
+            }
+        #else /* configUSE_EDF_SCHEDULER */
         UBaseType_t uxHigherPriorityReadyTasks = pdFALSE;
 
         /* uxHigherPriorityReadyTasks takes care of the case where
@@ -2349,6 +4099,7 @@ void vTaskSuspendAll( void )
         {
             xReturn = xNextTaskUnblockTime - xTickCount;
         }
+        #endif /* configUSE_EDF_SCHEDULER */
 
         return xReturn;
     }
@@ -2361,6 +4112,10 @@ BaseType_t xTaskResumeAll( void )
     TCB_t * pxTCB = NULL;
     BaseType_t xAlreadyYielded = pdFALSE;
 
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        BaseType_t xQueued;
+    #endif
+
     /* If uxSchedulerSuspended is zero then this function does not match a
      * previous call to vTaskSuspendAll(). */
     configASSERT( uxSchedulerSuspended );
@@ -2383,14 +4138,30 @@ BaseType_t xTaskResumeAll( void )
                 while( listLIST_IS_EMPTY( &xPendingReadyList ) == pdFALSE )
                 {
                     pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xPendingReadyList ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
-                    listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+
+                    /* E.C. : uxListRemove() as the head of the list is read
+                     * again on the next pass, see prvEDFMergeReleasedTasks(). */
+                    ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
                     portMEMORY_BARRIER();
-                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
+                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+
+                    #if ( configUSE_EDF_SCHEDULER == 1 )
+                        {
+                            xQueued = prvAddUnblockedTaskToReadyList( pxTCB );
+                        }
+                    #else
+                        {
+                            prvAddTaskToReadyList( pxTCB );
+                        }
+                    #endif
 
                     /* If the moved task has a priority higher than or equal to
                      * the current task then a yield must be performed. */
-                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    #if ( configUSE_EDF_SCHEDULER == 1 )
+                        if( ( xQueued != pdFALSE ) && ( taskEDF_PREEMPTS_CURRENT( pxTCB ) != pdFALSE ) )
+                    #else
+                        if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                    #endif
                     {
                         xYieldPending = pdTRUE;
                     }
@@ -2629,15 +4400,31 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
             } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 
             /* Search the delayed lists. */
-            if( pxTCB == NULL )
-            {
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
-            }
+            #if ( configEDF_DELAYED_WHEEL_SLOTS > 0 )
+                {
+                    for( uxQueue = ( UBaseType_t ) 0U; ( pxTCB == NULL ) && ( uxQueue < ( UBaseType_t ) configEDF_DELAYED_WHEEL_SLOTS ); uxQueue++ )
+                    {
+                        pxTCB = prvSearchForNameWithinSingleList( &( xEDFDelayedWheel[ uxQueue ] ), pcNameToQuery );
+                    }
 
-            if( pxTCB == NULL )
-            {
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
-            }
+                    if( pxTCB == NULL )
+                    {
+                        pxTCB = prvSearchForNameWithinSingleList( &xEDFDelayedFarList, pcNameToQuery );
+                    }
+                }
+            #else
+                {
+                    if( pxTCB == NULL )
+                    {
+                        pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+                    }
+
+                    if( pxTCB == NULL )
+                    {
+                        pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+                    }
+                }
+            #endif
 
             #if ( INCLUDE_vTaskSuspend == 1 )
                 {
@@ -2688,10 +4475,56 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
                     uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
                 } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 
+                /* E.C. : Under EDF only the idle task is in the ready lists
+                 * above, the other ready tasks are in the EDF ready queue. */
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    {
+                        #if ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_DEADLINE_BUCKETS )
+                            {
+                                for( uxQueue = ( UBaseType_t ) 0U; uxQueue < ( UBaseType_t ) configEDF_READY_BUCKETS; uxQueue++ )
+                                {
+                                    uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xEDFReadyBuckets[ uxQueue ] ), eReady );
+                                }
+                            }
+                        #else
+                            {
+                                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xReadyTasksListEDF, eReady );
+                            }
+                        #endif
+
+                        #if ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_SORTED_LIST )
+                            {
+                                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xEDFReleasedTasksList, eReady );
+                            }
+                        #endif
+
+                        /* Jobs held back by the SRP system ceiling are
+                         * ready, only not yet allowed to start. */
+                        #if ( configUSE_EDF_SRP == 1 )
+                            {
+                                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xEDFSRPHeldTasksList, eReady );
+                            }
+                        #endif
+                    }
+                #endif /* configUSE_EDF_SCHEDULER */
+
                 /* Fill in an TaskStatus_t structure with information on each
                  * task in the Blocked state. */
-                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-                uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+                #if ( configEDF_DELAYED_WHEEL_SLOTS > 0 )
+                    {
+                        for( uxQueue = ( UBaseType_t ) 0U; uxQueue < ( UBaseType_t ) configEDF_DELAYED_WHEEL_SLOTS; uxQueue++ )
+                        {
+                            uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xEDFDelayedWheel[ uxQueue ] ), eBlocked );
+                        }
+
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xEDFDelayedFarList, eBlocked );
+                    }
+                #else
+                    {
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+                        uxTask += prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+                    }
+                #endif
 
                 #if ( INCLUDE_vTaskDelete == 1 )
                     {
@@ -2766,9 +4599,36 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) /*lint !e971 Unqualified char
         /* Correct the tick count value after a period during which the tick
          * was suppressed.  Note this does *not* call the tick hook function for
          * each stepped tick. */
-        configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
-        xTickCount += xTicksToJump;
-        traceINCREASE_TICK_COUNT( xTicksToJump );
+        #if ( configEDF_DELAYED_WHEEL_SLOTS > 0 )
+            {
+                TickType_t xTicksToStep = xTicksToJump;
+
+                /* E.C. : The wheel is only searched on the tick that reaches
+                 * xNextTaskUnblockTime, so leave that tick to be processed by
+                 * xTaskIncrementTick() when the scheduler is resumed. */
+                configASSERT( xTicksToStep <= ( TickType_t ) ( xNextTaskUnblockTime - xTickCount ) );
+
+                if( xTicksToStep == ( TickType_t ) ( xNextTaskUnblockTime - xTickCount ) )
+                {
+                    configASSERT( xTicksToStep != ( TickType_t ) 0 );
+                    xPendedTicks++;
+                    xTicksToStep--;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xTickCount += xTicksToStep;
+                traceINCREASE_TICK_COUNT( xTicksToStep );
+            }
+        #else
+            {
+                configASSERT( ( xTickCount + xTicksToJump ) <= xNextTaskUnblockTime );
+                xTickCount += xTicksToJump;
+                traceINCREASE_TICK_COUNT( xTicksToJump );
+            }
+        #endif
     }
 
 #endif /* configUSE_TICKLESS_IDLE */
@@ -2799,6 +4659,10 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
         TCB_t * pxTCB = xTask;
         BaseType_t xReturn;
 
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            BaseType_t xQueued;
+        #endif
+
         configASSERT( pxTCB );
 
         vTaskSuspendAll();
@@ -2813,6 +4677,7 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
                  * interrupt won't touch the xStateListItem because the
                  * scheduler is suspended. */
                 ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                traceTASK_UNBLOCKED( pxTCB );
 
                 /* Is the task waiting on an event also?  If so remove it from
                  * the event list too.  Interrupts can touch the event list item,
@@ -2837,7 +4702,16 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
                 taskEXIT_CRITICAL();
 
                 /* Place the unblocked task into the appropriate ready list. */
-                prvAddTaskToReadyList( pxTCB );
+
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    {
+                        xQueued = prvAddUnblockedTaskToReadyList( pxTCB );
+                    }
+                #else
+                    {
+                        prvAddTaskToReadyList( pxTCB );
+                    }
+                #endif
 
                 /* A task being unblocked cannot cause an immediate context
                  * switch if preemption is turned off. */
@@ -2846,7 +4720,11 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
                         /* Preemption is on, but a context switch should only be
                          * performed if the unblocked task has a priority that is
                          * higher than the currently executing task. */
-                        if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                        #if ( configUSE_EDF_SCHEDULER == 1 )
+                            if( ( xQueued != pdFALSE ) && ( taskEDF_PREEMPTS_CURRENT( pxTCB ) != pdFALSE ) )
+                        #else
+                            if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                        #endif
                         {
                             /* Pend the yield to be performed when the scheduler
                              * is unsuspended. */
@@ -2878,6 +4756,10 @@ BaseType_t xTaskIncrementTick( void )
     TickType_t xItemValue;
     BaseType_t xSwitchRequired = pdFALSE;
 
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_TRACE_FACILITY == 1 ) )
+        BaseType_t xJobReleased = pdFALSE;
+    #endif
+
     /* Called by the portable layer each time a tick interrupt occurs.
      * Increments the tick then checks to see if the new tick value will cause any
      * tasks to be unblocked. */
@@ -2906,18 +4788,31 @@ BaseType_t xTaskIncrementTick( void )
          * the  queue in the order of their wake time - meaning once one task
          * has been found whose block time has not expired there is no need to
          * look any further down the list. */
-        if( xConstTickCount >= xNextTaskUnblockTime )
+        if( taskDELAYED_TASKS_DUE( xConstTickCount ) )
         {
+            /* E.C. : With the timing wheel this is the slot of the tasks due
+             * on this tick, otherwise the sorted delayed list. */
+            List_t * const pxDueTaskList = taskDUE_DELAYED_TASK_LIST( xConstTickCount );
+
             for( ; ; )
             {
-                if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+                if( listLIST_IS_EMPTY( pxDueTaskList ) != pdFALSE )
                 {
-                    /* The delayed list is empty.  Set xNextTaskUnblockTime
-                     * to the maximum possible value so it is extremely
-                     * unlikely that the
-                     * if( xTickCount >= xNextTaskUnblockTime ) test will pass
-                     * next time through. */
-                    xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                    #if ( configEDF_DELAYED_WHEEL_SLOTS > 0 )
+                        {
+                            /* E.C. : Find the next slot with tasks in it. */
+                            prvResetNextTaskUnblockTime();
+                        }
+                    #else
+                        {
+                            /* The delayed list is empty.  Set xNextTaskUnblockTime
+                             * to the maximum possible value so it is extremely
+                             * unlikely that the
+                             * if( xTickCount >= xNextTaskUnblockTime ) test will pass
+                             * next time through. */
+                            xNextTaskUnblockTime = portMAX_DELAY; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+                        }
+                    #endif
                     break;
                 }
                 else
@@ -2926,7 +4821,7 @@ BaseType_t xTaskIncrementTick( void )
                      * item at the head of the delayed list.  This is the time
                      * at which the task at the head of the delayed list must
                      * be removed from the Blocked state. */
-                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+                    pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxDueTaskList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
                     xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
 
                     if( xConstTickCount < xItemValue )
@@ -2944,90 +4839,267 @@ BaseType_t xTaskIncrementTick( void )
                         mtCOVERAGE_TEST_MARKER();
                     }
 
-                    /* It is time to remove the item from the Blocked state. */
-                    listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+                    /* It is time to remove the item from the Blocked state.
+                     * E.C. : uxListRemove() as the head of the list is read
+                     * again on the next pass, see prvEDFMergeReleasedTasks(). */
+                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
 
                     /* Is the task waiting on an event also?  If so remove
                      * it from the event list. */
                     if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
                     {
-                        listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+                        ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
                     }
                     else
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
 
-					/*E.C. Calculate the new task deadline and insert it in the correct position in the EDF ready list */
-					#if ( configUSE_EDF_SCHEDULER == 1 )
-						listSET_LIST_ITEM_VALUE( &( ( pxTCB )->xStateListItem ), ( pxTCB)->xTaskPeriod + xTaskGetTickCount() );
-					#endif																								 
-                    /* Place the unblocked task into the appropriate ready
-                     * list. */
-                    prvAddTaskToReadyList( pxTCB );
-
-					/*E.C. Context switching should take place based on tasks deadline */
+					/*E.C. A task waiting for its next job wakes at the release of that job, which
+					 * gives it a new deadline.  Any other task only had a timeout
+					 * expire, and goes on with the job and deadline it has. */
 					#if ( configUSE_EDF_SCHEDULER == 1 )
-						xSwitchRequired = pdTRUE;
-					#endif										 
-                    /* A task being unblocked cannot cause an immediate
-                     * context switch if preemption is turned off. */
-                    #if ( configUSE_PREEMPTION == 1 )
+						if( taskEDF_WAKE_RELEASES_JOB( pxTCB ) != pdFALSE )
+						{
+							prvEDFReleaseJob( pxTCB, xItemValue );
+
+							#if ( configUSE_TRACE_FACILITY == 1 )
+								{
+									xJobReleased = pdTRUE;
+								}
+							#endif
+						}
+						else
+						{
+							traceTASK_UNBLOCKED( pxTCB );
+						}
+					#else
+						traceTASK_UNBLOCKED( pxTCB );
+					#endif
+
+                    /* E.C. : A job held back by the system ceiling is neither
+                     * ready nor able to preempt until the ceiling drops. */
+                    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) )
                         {
-                            /* Preemption is on, but a context switch should
-                             * only be performed if the unblocked task has a
-                             * priority that is equal to or higher than the
-                             * currently executing task. */
-                            if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                            if( prvEDFSRPHoldJob( pxTCB ) != pdFALSE )
                             {
-                                xSwitchRequired = pdTRUE;
+                                continue;
                             }
                             else
                             {
                                 mtCOVERAGE_TEST_MARKER();
                             }
                         }
+                    #endif
+
+                    /* Place the unblocked task into the appropriate ready
+                     * list. */
+                    #if ( configUSE_EDF_SCHEDULER == 1 )
+                        prvAddReleasedTaskToReadyList( pxTCB );
+                    #else
+                        prvAddTaskToReadyList( pxTCB );
+                    #endif
+
+                    /* A task being unblocked cannot cause an immediate
+                     * context switch if preemption is turned off. */
+                    #if ( configUSE_PREEMPTION == 1 )
+                        {
+                            /*E.C. Context switching should take place based on tasks deadline */
+                            #if ( configUSE_EDF_SCHEDULER == 1 )
+                                {
+                                    /* Only switch if the released job has an
+                                     * earlier absolute deadline than the running
+                                     * one. */
+                                    if( taskEDF_PREEMPTS_CURRENT( pxTCB ) != pdFALSE )
+                                    {
+                                        xSwitchRequired = pdTRUE;
+                                    }
+                                    else
+                                    {
+                                        mtCOVERAGE_TEST_MARKER();
+                                    }
+                                }
+                            #else /* configUSE_EDF_SCHEDULER */
+                                {
+                                    /* Preemption is on, but a context switch should
+                                     * only be performed if the unblocked task has a
+                                     * priority that is equal to or higher than the
+                                     * currently executing task. */
+                                    if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+                                    {
+                                        xSwitchRequired = pdTRUE;
+                                    }
+                                    else
+                                    {
+                                        mtCOVERAGE_TEST_MARKER();
+                                    }
+                                }
+                            #endif /* configUSE_EDF_SCHEDULER */
+                        }
                     #endif /* configUSE_PREEMPTION */
                 }
             }
+
+            #if ( configUSE_EDF_SCHEDULER == 1 )
+                {
+                    taskMERGE_RELEASED_TASKS();
+                }
+            #endif
         }
 
-        /* Tasks of equal priority to the currently running task will share
-         * processing time (time slice) if preemption is on, and the application
-         * writer has not explicitly turned time slicing off. */
-        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+        /* E.C. : If any queued job is past its deadline the one with the
+         * earliest deadline is, whether or not it is the running task, which
+         * may not have been switched out yet or may be held in the background.
+         * Checking that one job each tick is enough to catch the first miss as
+         * it happens, the others are caught when they complete. */
+        #if ( configUSE_EDF_SCHEDULER == 1 )
             {
-                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+                pxTCB = taskEDF_EARLIEST_READY_TASK();
+
+                if( ( pxTCB != NULL ) && ( pxTCB->ucEDFJobState == taskEDF_JOB_ACTIVE ) &&
+                    ( prvEDFCheckDeadline( pxTCB, xConstTickCount ) != pdFALSE ) )
                 {
-                    xSwitchRequired = pdTRUE;
+                    /* The switch is only needed if the job taken out of the
+                     * Ready state is the running one. */
+                    #if ( configEDF_DEADLINE_MISS_POLICY == tskEDF_DEADLINE_MISS_ABORT )
+                        {
+                            if( ( prvEDFDeferJob( pxTCB, xConstTickCount ) != pdFALSE ) && ( pxTCB == pxCurrentTCB ) )
+                            {
+                                xSwitchRequired = pdTRUE;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
+                    #endif
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
-        #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
+        #endif /* configUSE_EDF_SCHEDULER */
 
-        #if ( configUSE_TICK_HOOK == 1 )
+        /* E.C. : Only the running job consumes its budget, so it is the only
+         * one to check.  Its run time is what was charged at the switches out
+         * so far plus the time since it was last switched in. */
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_BUDGET_ENFORCEMENT == 1 ) )
             {
-                /* Guard against the tick hook being called when the pended tick
-                 * count is being unwound (when the scheduler is being unlocked). */
-                if( xPendedTicks == ( TickType_t ) 0 )
+                if( ( pxCurrentTCB->ulTaskBudget != ( configRUN_TIME_COUNTER_TYPE ) 0 ) &&
+                    ( pxCurrentTCB->ucEDFJobState != taskEDF_JOB_DONE ) &&
+                    taskEDF_IN_READY_QUEUE( pxCurrentTCB ) )
                 {
-                    vApplicationTickHook();
+                    configRUN_TIME_COUNTER_TYPE ulRunTimeNow;
+
+                    taskEDF_GET_RUN_TIME_COUNTER_VALUE( ulRunTimeNow );
+
+                    if( ( pxCurrentTCB->ulJobRunTime + ( ulRunTimeNow - ulTaskSwitchedInTime ) ) >= pxCurrentTCB->ulTaskBudget )
+                    {
+                        traceTASK_BUDGET_EXHAUSTED( pxCurrentTCB );
+
+                        #if ( configEDF_BUDGET_POLICY == tskEDF_BUDGET_DEFER )
+                            {
+                                ( void ) prvEDFDeferJob( pxCurrentTCB, xConstTickCount );
+                            }
+                        #else
+                            {
+                                prvEDFMoveJobToBackground( pxCurrentTCB );
+                            }
+                        #endif
+
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
-        #endif /* configUSE_TICK_HOOK */
+        #endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_BUDGET_ENFORCEMENT == 1 ) */
 
-        #if ( configUSE_PREEMPTION == 1 )
+        /* E.C. : The running task is charged for the tick if it has a server
+         * with work pending. */
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SERVERS == 1 ) )
             {
-                if( xYieldPending != pdFALSE )
+                if( ( pxCurrentTCB->xServerBudget != ( TickType_t ) 0U ) && taskEDF_IN_READY_QUEUE( pxCurrentTCB ) )
                 {
-                    xSwitchRequired = pdTRUE;
+                    if( prvEDFServerCharge( pxCurrentTCB, xConstTickCount ) != pdFALSE )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SERVERS == 1 ) */
+
+        #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_TRACE_FACILITY == 1 ) )
+            {
+                if( xJobReleased != pdFALSE )
+                {
+                    if( xSwitchRequired != pdFALSE )
+                    {
+                        uxEDFReleaseSwitchesPerformed++;
+                    }
+                    else
+                    {
+                        uxEDFReleaseSwitchesAvoided++;
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        /* Tasks of equal priority to the currently running task will share
+         * processing time (time slice) if preemption is on, and the application
+         * writer has not explicitly turned time slicing off. */
+        #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
+            {
+                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
+
+        #if ( configUSE_TICK_HOOK == 1 )
+            {
+                /* Guard against the tick hook being called when the pended tick
+                 * count is being unwound (when the scheduler is being unlocked). */
+                if( xPendedTicks == ( TickType_t ) 0 )
+                {
+                    vApplicationTickHook();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif /* configUSE_TICK_HOOK */
+
+        #if ( configUSE_PREEMPTION == 1 )
+            {
+                if( xYieldPending != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
                 }
                 else
                 {
@@ -3196,6 +5268,13 @@ void vTaskSwitchContext( void )
                 if( ulTotalRunTime > ulTaskSwitchedInTime )
                 {
                     pxCurrentTCB->ulRunTimeCounter += ( ulTotalRunTime - ulTaskSwitchedInTime );
+
+                    /* E.C. : the time is charged to the current job too. */
+                    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_BUDGET_ENFORCEMENT == 1 ) )
+                        {
+                            pxCurrentTCB->ulJobRunTime += ( ulTotalRunTime - ulTaskSwitchedInTime );
+                        }
+                    #endif
                 }
                 else
                 {
@@ -3206,8 +5285,12 @@ void vTaskSwitchContext( void )
             }
         #endif /* configGENERATE_RUN_TIME_STATS */
 
-        /* Check for stack overflow, if configured. */
-        taskCHECK_FOR_STACK_OVERFLOW();
+        /* Check for stack overflow, if configured.  E.C. : A job task only has
+         * a stack while it carries out a job. */
+        if( taskEDF_HAS_OWN_STACK( pxCurrentTCB ) )
+        {
+            taskCHECK_FOR_STACK_OVERFLOW();
+        }
 
         /* Before the currently running task is switched out, save its errno. */
         #if ( configUSE_POSIX_ERRNO == 1 )
@@ -3228,7 +5311,15 @@ void vTaskSwitchContext( void )
 		}
 		#else
 		{
-			pxCurrentTCB = (TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &(xReadyTasksListEDF ) );
+			#if ( configEDF_JOB_CARRIERS > 0 )
+				prvEDFReleaseJobCarrier();
+			#endif
+
+			taskSELECT_EARLIEST_DEADLINE_TASK();
+
+			#if ( configEDF_JOB_CARRIERS > 0 )
+				prvEDFBindJobCarrier();
+			#endif
 			
 			//for tracing Tasks execution time
 			traceTASK_SWITCHED_IN();
@@ -3274,7 +5365,22 @@ void vTaskPlaceOnEventList( List_t * const pxEventList,
      *
      * The queue that contains the event list is locked, preventing
      * simultaneous access from interrupts. */
-    vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+
+    /* E.C. : Under EDF the tasks share one priority, so the event list is
+     * sorted by deadline instead and the task with the earliest deadline is
+     * the first to be woken.  The deadline changes from job to job, so it is
+     * stored each time the task waits, and compared so that the order holds
+     * across an overflow of the tick count. */
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        {
+            listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), taskEDF_READY_DEADLINE( pxCurrentTCB ) );
+            prvEDFListInsert( pxEventList, NULL, &( pxCurrentTCB->xEventListItem ) );
+        }
+    #else
+        {
+            vListInsert( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+        }
+    #endif
 
     prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
 }
@@ -3346,6 +5452,12 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
     TCB_t * pxUnblockedTCB;
     BaseType_t xReturn;
 
+    /* E.C. : A task held pending is queued by xTaskResumeAll(), which decides
+     * again whether to switch to it. */
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        BaseType_t xQueued = pdTRUE;
+    #endif
+
     /* THIS FUNCTION MUST BE CALLED FROM A CRITICAL SECTION.  It can also be
      * called from a critical section within an ISR. */
 
@@ -3362,11 +5474,21 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
     pxUnblockedTCB = listGET_OWNER_OF_HEAD_ENTRY( pxEventList ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
     configASSERT( pxUnblockedTCB );
     listREMOVE_ITEM( &( pxUnblockedTCB->xEventListItem ) );
+    traceTASK_UNBLOCKED( pxUnblockedTCB );
 
     if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
     {
         listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
-        prvAddTaskToReadyList( pxUnblockedTCB );
+
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                xQueued = prvAddUnblockedTaskToReadyList( pxUnblockedTCB );
+            }
+        #else
+            {
+                prvAddTaskToReadyList( pxUnblockedTCB );
+            }
+        #endif
 
         #if ( configUSE_TICKLESS_IDLE != 0 )
             {
@@ -3389,7 +5511,13 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
         listINSERT_END( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
     }
 
-    if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+    /* E.C. : Under EDF a context switch is only needed if the task woken has
+     * the earlier deadline and was not held back by SRP. */
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        if( ( xQueued != pdFALSE ) && ( taskEDF_PREEMPTS_CURRENT( pxUnblockedTCB ) != pdFALSE ) )
+    #else
+        if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+    #endif
     {
         /* Return true if the task removed from the event list has a higher
          * priority than the calling task.  This allows the calling task to know if
@@ -3414,6 +5542,10 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
 {
     TCB_t * pxUnblockedTCB;
 
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        BaseType_t xQueued;
+    #endif
+
     /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED.  It is used by
      * the event flags implementation. */
     configASSERT( uxSchedulerSuspended != pdFALSE );
@@ -3426,6 +5558,7 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
     pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
     configASSERT( pxUnblockedTCB );
     listREMOVE_ITEM( pxEventListItem );
+    traceTASK_UNBLOCKED( pxUnblockedTCB );
 
     #if ( configUSE_TICKLESS_IDLE != 0 )
         {
@@ -3445,9 +5578,22 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
      * scheduler is suspended so interrupts will not be accessing the ready
      * lists. */
     listREMOVE_ITEM( &( pxUnblockedTCB->xStateListItem ) );
-    prvAddTaskToReadyList( pxUnblockedTCB );
 
-    if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        {
+            xQueued = prvAddUnblockedTaskToReadyList( pxUnblockedTCB );
+        }
+    #else
+        {
+            prvAddTaskToReadyList( pxUnblockedTCB );
+        }
+    #endif
+
+    #if ( configUSE_EDF_SCHEDULER == 1 )
+        if( ( xQueued != pdFALSE ) && ( taskEDF_PREEMPTS_CURRENT( pxUnblockedTCB ) != pdFALSE ) )
+    #else
+        if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+    #endif
     {
         /* The unblocked task has a priority above that of the calling task, so
          * a context switch is required.  This function is called with the
@@ -3587,6 +5733,29 @@ void vTaskMissedYield( void )
     }
 
 #endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_TRACE_FACILITY == 1 ) )
+
+    void vTaskGetEDFReleaseSwitchCounts( UBaseType_t * const puxPerformed,
+                                         UBaseType_t * const puxAvoided )
+    {
+        taskENTER_CRITICAL();
+        {
+            if( puxPerformed != NULL )
+            {
+                *puxPerformed = uxEDFReleaseSwitchesPerformed;
+            }
+
+            if( puxAvoided != NULL )
+            {
+                *puxAvoided = uxEDFReleaseSwitchesAvoided;
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_TRACE_FACILITY == 1 ) */
 
 /*
  * -----------------------------------------------------------
@@ -3615,14 +5784,6 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
     for( ; ; )
     {
 		
-		/*E.C. Modify the idle task to keep it always the farest deadline */						
- 		#if( configUSE_EDF_SCHEDULER == 1)
-		{
-			listSET_LIST_ITEM_VALUE( &( ( pxCurrentTCB )->xStateListItem ), ( pxCurrentTCB )->xTaskPeriod + xTaskGetTickCount() );
-			listINSERT_END( &(xReadyTasksListEDF), &( ( pxCurrentTCB )->xStateListItem ) );
-		}
-		#endif 
-		
         /* See if any tasks have deleted themselves - if so then the idle task
          * is responsible for freeing the deleted task's TCB and stack. */
         prvCheckTasksWaitingTermination();
@@ -3694,7 +5855,11 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
                         /* Now the scheduler is suspended, the expected idle
                          * time can be sampled again, and this time its value can
                          * be used. */
-                        configASSERT( xNextTaskUnblockTime >= xTickCount );
+                        #if ( configEDF_DELAYED_WHEEL_SLOTS == 0 )
+                            {
+                                configASSERT( xNextTaskUnblockTime >= xTickCount );
+                            }
+                        #endif
                         xExpectedIdleTime = prvGetExpectedIdleTime();
 
                         /* Define the following macro to set xExpectedIdleTime to 0
@@ -3721,155 +5886,1418 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
                 }
             }
         #endif /* configUSE_TICKLESS_IDLE */
+
+        portIDLE_TASK_STEP();
     }
 }
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TICKLESS_IDLE != 0 )
+#if ( configUSE_TICKLESS_IDLE != 0 )
+
+    eSleepModeStatus eTaskConfirmSleepModeStatus( void )
+    {
+        /* The idle task exists in addition to the application tasks. */
+        const UBaseType_t uxNonApplicationTasks = 1;
+        eSleepModeStatus eReturn = eStandardSleep;
+
+        /* This function must be called from a critical section. */
+
+        if( listCURRENT_LIST_LENGTH( &xPendingReadyList ) != 0 )
+        {
+            /* A task was made ready while the scheduler was suspended. */
+            eReturn = eAbortSleep;
+        }
+        else if( xYieldPending != pdFALSE )
+        {
+            /* A yield was pended while the scheduler was suspended. */
+            eReturn = eAbortSleep;
+        }
+        else if( xPendedTicks != 0 )
+        {
+            /* A tick interrupt has already occurred but was held pending
+             * because the scheduler is suspended. */
+            eReturn = eAbortSleep;
+        }
+        else
+        {
+            /* If all the tasks are in the suspended list (which might mean they
+             * have an infinite block time rather than actually being suspended)
+             * then it is safe to turn all clocks off and just wait for external
+             * interrupts. */
+            if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == ( uxCurrentNumberOfTasks - uxNonApplicationTasks ) )
+            {
+                eReturn = eNoTasksWaitingTimeout;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return eReturn;
+    }
+
+#endif /* configUSE_TICKLESS_IDLE */
+/*-----------------------------------------------------------*/
+
+#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+
+    void vTaskSetThreadLocalStoragePointer( TaskHandle_t xTaskToSet,
+                                            BaseType_t xIndex,
+                                            void * pvValue )
+    {
+        TCB_t * pxTCB;
+
+        if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+        {
+            pxTCB = prvGetTCBFromHandle( xTaskToSet );
+            configASSERT( pxTCB != NULL );
+            pxTCB->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
+        }
+    }
+
+#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
+/*-----------------------------------------------------------*/
+
+#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+
+    void * pvTaskGetThreadLocalStoragePointer( TaskHandle_t xTaskToQuery,
+                                               BaseType_t xIndex )
+    {
+        void * pvReturn = NULL;
+        TCB_t * pxTCB;
+
+        if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+        {
+            pxTCB = prvGetTCBFromHandle( xTaskToQuery );
+            pvReturn = pxTCB->pvThreadLocalStoragePointers[ xIndex ];
+        }
+        else
+        {
+            pvReturn = NULL;
+        }
+
+        return pvReturn;
+    }
+
+#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
+/*-----------------------------------------------------------*/
+
+#if ( portUSING_MPU_WRAPPERS == 1 )
+
+    void vTaskAllocateMPURegions( TaskHandle_t xTaskToModify,
+                                  const MemoryRegion_t * const xRegions )
+    {
+        TCB_t * pxTCB;
+
+        /* If null is passed in here then we are modifying the MPU settings of
+         * the calling task. */
+        pxTCB = prvGetTCBFromHandle( xTaskToModify );
+
+        vPortStoreTaskMPUSettings( &( pxTCB->xMPUSettings ), xRegions, NULL, 0 );
+    }
+
+#endif /* portUSING_MPU_WRAPPERS */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseTaskLists( void )
+{
+    UBaseType_t uxPriority;
+	/* E.C. */
+	/* Initialize ready tasks list */
+	#if ( configUSE_EDF_SCHEDULER == 1 )
+	{
+		vListInitialise( &xReadyTasksListEDF );
+
+		#if ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_SORTED_LIST )
+		{
+			vListInitialise( &xEDFReleasedTasksList );
+		}
+		#endif
+
+		#if ( configUSE_EDF_SRP == 1 )
+		{
+			vListInitialise( &xEDFSRPHeldTasksList );
+
+			for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configEDF_SRP_RESOURCES; uxPriority++ )
+			{
+				xEDFSRPResources[ uxPriority ].xCeiling = portMAX_DELAY;
+				xEDFSRPResources[ uxPriority ].pxHolder = NULL;
+			}
+		}
+		#endif
+
+		#if ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_DEADLINE_BUCKETS )
+		{
+			for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configEDF_READY_BUCKETS; uxPriority++ )
+			{
+				vListInitialise( &( xEDFReadyBuckets[ uxPriority ] ) );
+			}
+		}
+		#endif
+	}
+	#endif  
+
+    for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+    {
+        vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
+    }
+
+    vListInitialise( &xDelayedTaskList1 );
+    vListInitialise( &xDelayedTaskList2 );
+    vListInitialise( &xPendingReadyList );
+
+    #if ( configEDF_DELAYED_WHEEL_SLOTS > 0 )
+        {
+            for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configEDF_DELAYED_WHEEL_SLOTS; uxPriority++ )
+            {
+                vListInitialise( &( xEDFDelayedWheel[ uxPriority ] ) );
+            }
+
+            vListInitialise( &xEDFDelayedFarList );
+        }
+    #endif /* configEDF_DELAYED_WHEEL_SLOTS */
+
+    #if ( INCLUDE_vTaskDelete == 1 )
+        {
+            vListInitialise( &xTasksWaitingTermination );
+        }
+    #endif /* INCLUDE_vTaskDelete */
+
+    #if ( INCLUDE_vTaskSuspend == 1 )
+        {
+            vListInitialise( &xSuspendedTaskList );
+        }
+    #endif /* INCLUDE_vTaskSuspend */
+
+    /* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
+     * using list2. */
+    pxDelayedTaskList = &xDelayedTaskList1;
+    pxOverflowDelayedTaskList = &xDelayedTaskList2;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static void prvEDFAddTaskToDelayedList( TCB_t * pxTCB,
+                                            const TickType_t xTimeToWake )
+    {
+        const TickType_t xConstTickCount = xTickCount;
+
+        /* The list item will be inserted in wake time order. */
+        listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), xTimeToWake );
+
+        /* Before the scheduler starts xNextTaskUnblockTime is not set yet,
+         * vTaskStartScheduler() finds it from the delayed tasks. */
+        #if ( configEDF_DELAYED_WHEEL_SLOTS > 0 )
+            {
+                prvEDFWheelInsert( &( pxTCB->xStateListItem ), xConstTickCount );
+
+                if( ( xTimeToWake - xConstTickCount ) < ( TickType_t ) ( xNextTaskUnblockTime - xConstTickCount ) )
+                {
+                    xNextTaskUnblockTime = xTimeToWake;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #else /* configEDF_DELAYED_WHEEL_SLOTS */
+            {
+                if( xTimeToWake < xConstTickCount )
+                {
+                    vListInsert( pxOverflowDelayedTaskList, &( pxTCB->xStateListItem ) );
+                }
+                else
+                {
+                    vListInsert( pxDelayedTaskList, &( pxTCB->xStateListItem ) );
+
+                    if( xTimeToWake < xNextTaskUnblockTime )
+                    {
+                        xNextTaskUnblockTime = xTimeToWake;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+        #endif /* configEDF_DELAYED_WHEEL_SLOTS */
+    }
+
+#endif /* configUSE_EDF_SCHEDULER */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static void prvEDFReleaseJob( TCB_t * pxTCB,
+                                  const TickType_t xRelease )
+    {
+        pxTCB->xTaskRelease = xRelease;
+        pxTCB->xTaskDeadline = xRelease + pxTCB->xTaskRelativeDeadline;
+        pxTCB->ucEDFJobState = taskEDF_JOB_ACTIVE;
+
+        #if ( configEDF_BUDGET_ENFORCEMENT == 1 )
+            {
+                pxTCB->ulJobRunTime = ( configRUN_TIME_COUNTER_TYPE ) 0;
+            }
+        #endif
+
+        traceTASK_RELEASED( pxTCB );
+    }
+    /*-----------------------------------------------------------*/
+
+    static BaseType_t prvEDFCheckDeadline( TCB_t * pxTCB,
+                                           const TickType_t xConstTickCount )
+    {
+        BaseType_t xLate = pdFALSE;
+        TickType_t xLateness;
+
+        /* A task that is not periodic has no deadline to miss.  The deadline
+         * tick itself is already too late, the job had to complete within the
+         * tick before. */
+        if( ( pxTCB->xTaskRelativeDeadline != ( TickType_t ) 0U ) &&
+            ( taskEDF_DEADLINE_BEFORE( xConstTickCount, pxTCB->xTaskDeadline ) == pdFALSE ) )
+        {
+            xLate = pdTRUE;
+            xLateness = xConstTickCount - pxTCB->xTaskDeadline;
+
+            if( xLateness > pxTCB->xMaxLateness )
+            {
+                pxTCB->xMaxLateness = xLateness;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxTCB->ucEDFJobState == taskEDF_JOB_ACTIVE )
+            {
+                pxTCB->ucEDFJobState = taskEDF_JOB_MISSED;
+                ( pxTCB->uxDeadlineMisses )++;
+                traceTASK_DEADLINE_MISSED( pxTCB, xLateness );
+
+                #if ( configUSE_DEADLINE_MISS_HOOK == 1 )
+                    {
+                        extern void vApplicationDeadlineMissHook( TaskHandle_t xTask,
+                                                                  TickType_t xLateness );
+
+                        /* Called from the tick interrupt or with the scheduler
+                         * suspended, so like the tick hook it must not block. */
+                        vApplicationDeadlineMissHook( ( TaskHandle_t ) pxTCB, xLateness );
+                    }
+                #endif
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xLate;
+    }
+
+#endif /* configUSE_EDF_SCHEDULER */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( taskEDF_DEFER_JOBS ) )
+
+    static BaseType_t prvEDFDeferJob( TCB_t * pxTCB,
+                                      const TickType_t xConstTickCount )
+    {
+        TickType_t xNextRelease = ( pxTCB->xTaskDeadline - pxTCB->xTaskRelativeDeadline ) + pxTCB->xTaskPeriod;
+        BaseType_t xDeferred;
+
+        /* A task caught between leaving the Ready state and the context
+         * switch that follows is left to complete its job as usual.  A job
+         * in the background is ready too. */
+        xDeferred = taskEDF_IN_READY_QUEUE( pxTCB ) ? pdTRUE : pdFALSE;
+
+        #if ( taskEDF_BACKGROUND_JOBS )
+            {
+                if( ( xDeferred == pdFALSE ) && ( pxTCB != xIdleTaskHandle ) && taskEDF_IN_BACKGROUND( pxTCB ) )
+                {
+                    xDeferred = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        if( xDeferred != pdFALSE )
+        {
+            /* Releases that have gone by already are dropped with the job. */
+            while( taskEDF_DEADLINE_BEFORE( xConstTickCount, xNextRelease ) == pdFALSE )
+            {
+                xNextRelease += pxTCB->xTaskPeriod;
+            }
+
+            /* The heap and the buckets drop the task lazily once it has left
+             * its ready list.  What is left of the job runs as the job of the
+             * release it waits for. */
+            ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+            pxTCB->ucEDFJobState = taskEDF_JOB_DEFERRED;
+            prvEDFAddTaskToDelayedList( pxTCB, xNextRelease );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xDeferred;
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( taskEDF_DEFER_JOBS ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( taskEDF_BACKGROUND_JOBS ) )
+
+    static void prvEDFMoveJobToBackground( TCB_t * pxTCB )
+    {
+        /* The task leaves the buckets by its deadline, which is still held
+         * in its list item.  The heap drops it lazily. */
+        #if ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_DEADLINE_BUCKETS )
+            {
+                prvEDFBucketRemove( pxTCB );
+            }
+        #else
+            {
+                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+            }
+        #endif
+
+        listINSERT_END( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ), &( pxTCB->xStateListItem ) );
+    }
+
+    static TCB_t * prvEDFGetBackgroundTask( void )
+    {
+        TCB_t * pxTCB;
+
+        /* The idle task never leaves this list, so it is never empty. */
+        listGET_OWNER_OF_NEXT_ENTRY( pxTCB, &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+
+        return pxTCB;
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( taskEDF_BACKGROUND_JOBS ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SERVERS == 1 ) )
+
+    static void prvEDFServerArrival( TCB_t * pxTCB )
+    {
+        const TickType_t xConstTickCount = xTickCount;
+
+        pxTCB->ucServerIdle = ( uint8_t ) pdFALSE;
+
+        /* The budget left is kept with the current deadline unless it is
+         * more than the server may use up by then, capacity / ( deadline -
+         * now ) >= Q / T, or the deadline has gone by.  The deadline lies at
+         * most T ahead, so both products stay within Q * T. */
+        if( ( taskEDF_DEADLINE_BEFORE( xConstTickCount, pxTCB->xServerDeadline ) == pdFALSE ) ||
+            ( ( ( uint64_t ) pxTCB->xServerCapacity * pxTCB->xTaskPeriod ) >= ( ( uint64_t ) ( pxTCB->xServerDeadline - xConstTickCount ) * pxTCB->xServerBudget ) ) )
+        {
+            pxTCB->xServerDeadline = xConstTickCount + pxTCB->xTaskPeriod;
+            pxTCB->xServerCapacity = pxTCB->xServerBudget;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxTCB->xTaskDeadline = pxTCB->xServerDeadline;
+    }
+
+    static BaseType_t prvEDFServerCharge( TCB_t * pxTCB,
+                                          const TickType_t xConstTickCount )
+    {
+        BaseType_t xPostponed = pdFALSE;
+
+        pxTCB->xServerCapacity--;
+
+        if( pxTCB->xServerCapacity == ( TickType_t ) 0U )
+        {
+            pxTCB->xServerCapacity = pxTCB->xServerBudget;
+
+            if( taskEDF_DEADLINE_BEFORE( xConstTickCount, pxTCB->xServerDeadline ) != pdFALSE )
+            {
+                /* Ahead of its deadline, the server waits for it before it is
+                 * refilled.  The task then becomes ready as an arrival, which
+                 * sets the deadline T after the old one. */
+                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                pxTCB->ucServerIdle = ( uint8_t ) pdTRUE;
+                prvEDFAddTaskToDelayedList( pxTCB, pxTCB->xServerDeadline );
+            }
+            else
+            {
+                pxTCB->xServerDeadline += pxTCB->xTaskPeriod;
+                prvEDFSetReadyTaskDeadline( pxTCB, pxTCB->xServerDeadline );
+            }
+
+            xPostponed = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xPostponed;
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SERVERS == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_ADMISSION_CONTROL == 1 ) )
+
+    static BaseType_t prvEDFAdmissionTest( const TickType_t xWCET,
+                                           const TickType_t xDeadline,
+                                           const TickType_t xPeriod )
+    {
+        const TCB_t * pxTCB;
+        const uint64_t ullUtilisation = ullEDFUtilisation + taskEDF_UTILISATION_OF( xWCET, xPeriod );
+        TickType_t xInterval, xMinDeadline = xDeadline;
+        uint64_t ullDemand;
+        UBaseType_t uxSteps = ( UBaseType_t ) 0U;
+        BaseType_t xAdmitted;
+
+        if( ullUtilisation > taskEDF_UTILISATION_ONE )
+        {
+            xAdmitted = pdFALSE;
+        }
+        else if( ( xDeadline >= xPeriod ) && ( uxEDFConstrainedTasks == ( UBaseType_t ) 0U ) )
+        {
+            /* With no deadline shorter than its period a utilisation of at
+             * most 1 is all EDF needs. */
+            xAdmitted = pdTRUE;
+        }
+        else if( ullUtilisation == taskEDF_UTILISATION_ONE )
+        {
+            /* A fully loaded processor never idles, so there is no busy
+             * period to bound the analysis. */
+            xAdmitted = pdFALSE;
+        }
+        else
+        {
+            for( pxTCB = pxEDFAdmittedTasks; pxTCB != NULL; pxTCB = pxTCB->pxEDFNextAdmitted )
+            {
+                if( taskEDF_ADMITTED_DEADLINE( pxTCB ) < xMinDeadline )
+                {
+                    xMinDeadline = taskEDF_ADMITTED_DEADLINE( pxTCB );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+
+            /* Starting from the last deadline in the busy period, the
+             * interval checked shrinks to the demand due by it, or to the
+             * deadline before it once the two meet.  The set is schedulable
+             * if the demand falls to the earliest deadline without ever
+             * exceeding its interval. */
+            xInterval = prvEDFBusyPeriod( xWCET, xPeriod );
+
+            if( xInterval == ( TickType_t ) 0U )
+            {
+                /* No bound on the intervals to check. */
+                ullDemand = ( uint64_t ) portMAX_DELAY + 1U;
+            }
+            else
+            {
+                xInterval = prvEDFLastDeadlineBefore( xInterval, xDeadline, xPeriod );
+                ullDemand = prvEDFProcessorDemand( xInterval, xWCET, xDeadline, xPeriod );
+            }
+
+            /* Each step moves the interval to an earlier deadline, so the
+             * loop ends, but over a long busy period it can take many.  A set
+             * still undecided after the last step is refused. */
+            while( ( ullDemand <= xInterval ) && ( ullDemand > xMinDeadline ) )
+            {
+                if( uxSteps == ( UBaseType_t ) configEDF_ADMISSION_MAX_STEPS )
+                {
+                    ullDemand = ( uint64_t ) portMAX_DELAY + 1U;
+                    break;
+                }
+
+                uxSteps++;
+
+                if( ullDemand < xInterval )
+                {
+                    xInterval = ( TickType_t ) ullDemand;
+                }
+                else
+                {
+                    xInterval = prvEDFLastDeadlineBefore( xInterval, xDeadline, xPeriod );
+                }
+
+                ullDemand = prvEDFProcessorDemand( xInterval, xWCET, xDeadline, xPeriod );
+            }
+
+            xAdmitted = ( ullDemand <= xMinDeadline ) ? pdTRUE : pdFALSE;
+        }
+
+        return xAdmitted;
+    }
+
+    static void prvEDFAdmitTask( TCB_t * pxTCB )
+    {
+        if( pxTCB->xTaskWCET != ( TickType_t ) 0U )
+        {
+            pxTCB->pxEDFNextAdmitted = pxEDFAdmittedTasks;
+            pxEDFAdmittedTasks = pxTCB;
+            ullEDFUtilisation += taskEDF_UTILISATION_OF( pxTCB->xTaskWCET, pxTCB->xTaskPeriod );
+
+            if( taskEDF_ADMITTED_DEADLINE( pxTCB ) < pxTCB->xTaskPeriod )
+            {
+                uxEDFConstrainedTasks++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    static void prvEDFWithdrawTask( TCB_t * pxTCB )
+    {
+        TCB_t ** ppxLink = &pxEDFAdmittedTasks;
+
+        while( *ppxLink != NULL )
+        {
+            if( *ppxLink == pxTCB )
+            {
+                *ppxLink = pxTCB->pxEDFNextAdmitted;
+                ullEDFUtilisation -= taskEDF_UTILISATION_OF( pxTCB->xTaskWCET, pxTCB->xTaskPeriod );
+
+                if( taskEDF_ADMITTED_DEADLINE( pxTCB ) < pxTCB->xTaskPeriod )
+                {
+                    uxEDFConstrainedTasks--;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                break;
+            }
+
+            ppxLink = &( ( *ppxLink )->pxEDFNextAdmitted );
+        }
+    }
+
+    static TickType_t prvEDFBusyPeriod( const TickType_t xWCET,
+                                        const TickType_t xPeriod )
+    {
+        const TCB_t * pxTCB;
+        uint64_t ullBusyPeriod, ullWork = xWCET;
+        UBaseType_t uxSteps = ( UBaseType_t ) 0U;
+
+        for( pxTCB = pxEDFAdmittedTasks; pxTCB != NULL; pxTCB = pxTCB->pxEDFNextAdmitted )
+        {
+            ullWork += pxTCB->xTaskWCET;
+        }
+
+        /* The work released until the processor first idles, with every
+         * task released at once.  It settles as the utilisation is below 1,
+         * but the closer it is to 1 the longer that takes, so the search is
+         * given up after configEDF_ADMISSION_MAX_STEPS steps or once the
+         * work no longer fits in a TickType_t. */
+        do
+        {
+            ullBusyPeriod = ullWork;
+            ullWork = ( ( ullBusyPeriod + xPeriod - 1U ) / xPeriod ) * xWCET;
+
+            for( pxTCB = pxEDFAdmittedTasks; pxTCB != NULL; pxTCB = pxTCB->pxEDFNextAdmitted )
+            {
+                ullWork += ( ( ullBusyPeriod + pxTCB->xTaskPeriod - 1U ) / pxTCB->xTaskPeriod ) * pxTCB->xTaskWCET;
+            }
+
+            uxSteps++;
+        } while( ( ullWork != ullBusyPeriod ) &&
+                 ( ullWork <= ( uint64_t ) portMAX_DELAY ) &&
+                 ( uxSteps < ( UBaseType_t ) configEDF_ADMISSION_MAX_STEPS ) );
+
+        if( ( ullWork != ullBusyPeriod ) || ( ullBusyPeriod > ( uint64_t ) portMAX_DELAY ) )
+        {
+            ullBusyPeriod = 0U;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return ( TickType_t ) ullBusyPeriod;
+    }
+
+    static uint64_t prvEDFProcessorDemand( const TickType_t xInterval,
+                                           const TickType_t xWCET,
+                                           const TickType_t xDeadline,
+                                           const TickType_t xPeriod )
+    {
+        const TCB_t * pxTCB;
+        uint64_t ullDemand = 0U;
+
+        /* Summed in 64 bits, as the demand of a set that overloads the
+         * interval can exceed the range of a TickType_t. */
+        if( xInterval >= xDeadline )
+        {
+            ullDemand += ( uint64_t ) ( ( ( xInterval - xDeadline ) / xPeriod ) + 1U ) * xWCET;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        for( pxTCB = pxEDFAdmittedTasks; pxTCB != NULL; pxTCB = pxTCB->pxEDFNextAdmitted )
+        {
+            if( xInterval >= taskEDF_ADMITTED_DEADLINE( pxTCB ) )
+            {
+                ullDemand += ( uint64_t ) ( ( ( xInterval - taskEDF_ADMITTED_DEADLINE( pxTCB ) ) / pxTCB->xTaskPeriod ) + 1U ) * pxTCB->xTaskWCET;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return ullDemand;
+    }
+
+    static TickType_t prvEDFLastDeadlineBefore( const TickType_t xInterval,
+                                                const TickType_t xDeadline,
+                                                const TickType_t xPeriod )
+    {
+        const TCB_t * pxTCB;
+        TickType_t xLast = ( TickType_t ) 0U, xCandidate;
+
+        if( xInterval > xDeadline )
+        {
+            xLast = xDeadline + ( ( ( xInterval - xDeadline - 1U ) / xPeriod ) * xPeriod );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        for( pxTCB = pxEDFAdmittedTasks; pxTCB != NULL; pxTCB = pxTCB->pxEDFNextAdmitted )
+        {
+            if( xInterval > taskEDF_ADMITTED_DEADLINE( pxTCB ) )
+            {
+                xCandidate = taskEDF_ADMITTED_DEADLINE( pxTCB ) + ( ( ( xInterval - taskEDF_ADMITTED_DEADLINE( pxTCB ) - 1U ) / pxTCB->xTaskPeriod ) * pxTCB->xTaskPeriod );
+
+                if( xCandidate > xLast )
+                {
+                    xLast = xCandidate;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xLast;
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_ADMISSION_CONTROL == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( ( INCLUDE_xTaskDelayUntil == 1 ) || ( configUSE_EDF_SERVERS == 1 ) || ( configUSE_MUTEXES == 1 ) ) )
+
+    static void prvEDFSetReadyTaskDeadline( TCB_t * pxTCB,
+                                            const TickType_t xDeadline )
+    {
+        /* The task leaves the queue by its old deadline, as the buckets find
+         * its bucket from the list item value. */
+        #if ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_DEADLINE_BUCKETS )
+            {
+                prvEDFBucketRemove( pxTCB );
+            }
+        #else
+            {
+                /* The heap moves the entry the task already has. */
+                ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+            }
+        #endif
+
+        pxTCB->xTaskDeadline = xDeadline;
+        prvAddTaskToReadyList( pxTCB );
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( ( INCLUDE_xTaskDelayUntil == 1 ) || ( configUSE_EDF_SERVERS == 1 ) || ( configUSE_MUTEXES == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) )
+
+    static BaseType_t prvEDFSRPHoldJob( TCB_t * pxTCB )
+    {
+        BaseType_t xHeld = pdFALSE;
+
+        /* The system ceiling is portMAX_DELAY while no resource is held, so
+         * a single comparison covers the usual case. */
+        if( taskEDF_PREEMPTION_LEVEL( pxTCB ) >= xEDFSystemCeiling )
+        {
+            listSET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ), taskEDF_PREEMPTION_LEVEL( pxTCB ) );
+            vListInsert( &xEDFSRPHeldTasksList, &( pxTCB->xStateListItem ) );
+            xHeld = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xHeld;
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static BaseType_t prvAddUnblockedTaskToReadyList( TCB_t * pxTCB )
+    {
+        BaseType_t xQueued = pdTRUE;
+
+        #if ( configUSE_EDF_SRP == 1 )
+            {
+                if( prvEDFSRPHoldJob( pxTCB ) != pdFALSE )
+                {
+                    xQueued = pdFALSE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        if( xQueued != pdFALSE )
+        {
+            prvAddTaskToReadyList( pxTCB );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xQueued;
+    }
+
+#endif /* configUSE_EDF_SCHEDULER */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_JOB_CARRIERS > 0 ) )
+
+    static portTASK_FUNCTION( prvEDFJobCarrier, pvParameters )
+    {
+        ( void ) pvParameters;
+
+        for( ; ; )
+        {
+            /* The task carried is the current task.  Once its job has
+             * completed the carrier may be given to another task while it
+             * waits, and it runs the job of that one when it resumes. */
+            pxCurrentTCB->pxJobCode( pxCurrentTCB->pvJobParameters );
+            ( void ) xTaskWaitForNextPeriod();
+        }
+    }
+    /*-----------------------------------------------------------*/
+
+    static void prvEDFInitialiseJobCarriers( void )
+    {
+        UBaseType_t uxCarrier;
+
+        for( uxCarrier = ( UBaseType_t ) 0U; uxCarrier < ( UBaseType_t ) configEDF_JOB_CARRIERS; uxCarrier++ )
+        {
+            xEDFJobCarriers[ uxCarrier ].pxStack = xEDFJobStacks[ uxCarrier ];
+            prvInitialiseNewTask( prvEDFJobCarrier, "Job", ( uint32_t ) configEDF_JOB_STACK_DEPTH, NULL, tskIDLE_PRIORITY, NULL, &( xEDFJobCarriers[ uxCarrier ] ), NULL );
+
+            xEDFJobCarriers[ uxCarrier ].pxJobCarrier = pxEDFFreeJobCarriers;
+            pxEDFFreeJobCarriers = &( xEDFJobCarriers[ uxCarrier ] );
+        }
+    }
+    /*-----------------------------------------------------------*/
+
+    static void prvEDFReleaseJobCarrier( void )
+    {
+        TCB_t * const pxCarrier = pxCurrentTCB->pxJobCarrier;
+
+        /* The context of the task was saved on the stack of the carrier,
+         * which resumes from there with the next task it carries. */
+        if( ( pxCarrier != NULL ) && ( pxCurrentTCB->ucEDFJobState == taskEDF_JOB_DONE ) )
+        {
+            pxCarrier->pxTopOfStack = pxCurrentTCB->pxTopOfStack;
+            pxCarrier->pxJobCarrier = pxEDFFreeJobCarriers;
+            pxEDFFreeJobCarriers = pxCarrier;
+
+            /* The task is left without a stack until its next job. */
+            pxCurrentTCB->pxJobCarrier = NULL;
+            pxCurrentTCB->pxTopOfStack = NULL;
+            pxCurrentTCB->pxStack = NULL;
+            #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
+                {
+                    pxCurrentTCB->pxEndOfStack = NULL;
+                }
+            #endif
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    /*-----------------------------------------------------------*/
+
+    static void prvEDFBindJobCarrier( void )
+    {
+        TCB_t * pxCarrier;
+
+        if( ( pxCurrentTCB->pxJobCode != NULL ) && ( pxCurrentTCB->pxJobCarrier == NULL ) )
+        {
+            /* A job only preempts jobs with later deadlines, so more jobs
+             * than carriers have started only if configEDF_JOB_CARRIERS is
+             * below the depth of preemption. */
+            configASSERT( pxEDFFreeJobCarriers != NULL );
+
+            pxCarrier = pxEDFFreeJobCarriers;
+            pxEDFFreeJobCarriers = pxCarrier->pxJobCarrier;
+
+            pxCurrentTCB->pxTopOfStack = pxCarrier->pxTopOfStack;
+            pxCurrentTCB->pxStack = pxCarrier->pxStack;
+            #if ( ( portSTACK_GROWTH > 0 ) || ( configRECORD_STACK_HIGH_ADDRESS == 1 ) )
+                {
+                    pxCurrentTCB->pxEndOfStack = pxCarrier->pxEndOfStack;
+                }
+            #endif
+            pxCurrentTCB->pxJobCarrier = pxCarrier;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_JOB_CARRIERS > 0 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULER == 1 )
+
+    static void prvEDFListInsert( List_t * const pxList,
+                                  ListItem_t * pxPrevious,
+                                  ListItem_t * const pxNewListItem )
+    {
+        const TickType_t xDeadline = listGET_LIST_ITEM_VALUE( pxNewListItem );
+        const ListItem_t * const pxEnd = listGET_END_MARKER( pxList );
+        ListItem_t * pxNext = ( pxPrevious == NULL ) ? listGET_HEAD_ENTRY( pxList ) : listGET_NEXT( pxPrevious );
+
+        /* Equal deadlines keep their arrival order. */
+        while( ( pxNext != pxEnd ) && ( taskEDF_DEADLINE_BEFORE( xDeadline, listGET_LIST_ITEM_VALUE( pxNext ) ) == pdFALSE ) )
+        {
+            pxPrevious = pxNext;
+            pxNext = listGET_NEXT( pxNext );
+        }
+
+        /* The end marker is a MiniListItem_t, so the links it holds are only
+         * written through the list itself, never through a ListItem_t. */
+        pxNewListItem->pxNext = pxNext;
+
+        if( pxPrevious == NULL )
+        {
+            pxNewListItem->pxPrevious = ( ListItem_t * ) &( pxList->xListEnd ); /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+            pxList->xListEnd.pxNext = pxNewListItem;
+        }
+        else
+        {
+            pxNewListItem->pxPrevious = pxPrevious;
+            pxPrevious->pxNext = pxNewListItem;
+        }
+
+        if( pxNext == pxEnd )
+        {
+            pxList->xListEnd.pxPrevious = pxNewListItem;
+        }
+        else
+        {
+            pxNext->pxPrevious = pxNewListItem;
+        }
+
+        pxNewListItem->pxContainer = pxList;
+        ( pxList->uxNumberOfItems )++;
+    }
+
+#endif /* configUSE_EDF_SCHEDULER == 1 */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_SORTED_LIST ) )
+
+    static void prvEDFMergeReleasedTasks( void )
+    {
+        ListItem_t * pxItem = NULL;
+        ListItem_t * pxPrevious;
+
+        while( listLIST_IS_EMPTY( &xEDFReleasedTasksList ) == pdFALSE )
+        {
+            /* uxListRemove() rather than listREMOVE_ITEM(): the macro writes
+             * the end marker of the list through a ListItem_t pointer, and
+             * with strict aliasing the compiler may then read a stale head on
+             * the next pass and merge the same task twice. */
+            pxPrevious = pxItem;
+            pxItem = listGET_HEAD_ENTRY( &xEDFReleasedTasksList );
+            ( void ) uxListRemove( pxItem );
+
+            /* Carry on from where the previous released task was placed. */
+            prvEDFListInsert( &xReadyTasksListEDF, pxPrevious, pxItem );
+        }
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_SORTED_LIST ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_BINARY_HEAP ) )
+
+    static void prvEDFHeapSet( UBaseType_t uxIndex,
+                               const EDFHeapNode_t * pxNode )
+    {
+        xEDFReadyHeap[ uxIndex ] = *pxNode;
+        pxNode->pxTCB->uxEDFHeapIndex = uxIndex;
+    }
+
+    static void prvEDFHeapSiftUp( UBaseType_t uxIndex )
+    {
+        const EDFHeapNode_t xNode = xEDFReadyHeap[ uxIndex ];
+        UBaseType_t uxParent;
+
+        /* Move parents with a later deadline down until the hole reaches
+         * the position of the node. */
+        while( uxIndex > ( UBaseType_t ) 1U )
+        {
+            uxParent = uxIndex >> 1;
+
+            if( taskEDF_DEADLINE_BEFORE( xNode.xDeadline, xEDFReadyHeap[ uxParent ].xDeadline ) == pdFALSE )
+            {
+                break;
+            }
+
+            prvEDFHeapSet( uxIndex, &( xEDFReadyHeap[ uxParent ] ) );
+            uxIndex = uxParent;
+        }
 
-    eSleepModeStatus eTaskConfirmSleepModeStatus( void )
-    {
-        /* The idle task exists in addition to the application tasks. */
-        const UBaseType_t uxNonApplicationTasks = 1;
-        eSleepModeStatus eReturn = eStandardSleep;
+        prvEDFHeapSet( uxIndex, &xNode );
+    }
 
-        /* This function must be called from a critical section. */
+    static void prvEDFHeapSiftDown( UBaseType_t uxIndex )
+    {
+        const EDFHeapNode_t xNode = xEDFReadyHeap[ uxIndex ];
+        UBaseType_t uxChild;
 
-        if( listCURRENT_LIST_LENGTH( &xPendingReadyList ) != 0 )
+        /* Move the child with the earliest deadline up until the hole
+         * reaches the position of the node. */
+        for( ; ; )
         {
-            /* A task was made ready while the scheduler was suspended. */
-            eReturn = eAbortSleep;
+            uxChild = uxIndex << 1;
+
+            if( uxChild > uxEDFReadyHeapSize )
+            {
+                break;
+            }
+
+            if( ( uxChild < uxEDFReadyHeapSize ) && ( taskEDF_DEADLINE_BEFORE( xEDFReadyHeap[ uxChild + 1U ].xDeadline, xEDFReadyHeap[ uxChild ].xDeadline ) != pdFALSE ) )
+            {
+                uxChild++;
+            }
+
+            if( taskEDF_DEADLINE_BEFORE( xEDFReadyHeap[ uxChild ].xDeadline, xNode.xDeadline ) == pdFALSE )
+            {
+                break;
+            }
+
+            prvEDFHeapSet( uxIndex, &( xEDFReadyHeap[ uxChild ] ) );
+            uxIndex = uxChild;
         }
-        else if( xYieldPending != pdFALSE )
+
+        prvEDFHeapSet( uxIndex, &xNode );
+    }
+
+    static void prvEDFHeapInsert( TCB_t * pxTCB )
+    {
+        const TickType_t xDeadline = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+        UBaseType_t uxIndex = pxTCB->uxEDFHeapIndex;
+
+        if( uxIndex == ( UBaseType_t ) 0U )
         {
-            /* A yield was pended while the scheduler was suspended. */
-            eReturn = eAbortSleep;
+            /* Not held yet, so start from a new leaf. */
+            configASSERT( uxEDFReadyHeapSize < ( UBaseType_t ) configEDF_READY_HEAP_LENGTH );
+            uxEDFReadyHeapSize++;
+            uxIndex = uxEDFReadyHeapSize;
+            xEDFReadyHeap[ uxIndex ].pxTCB = pxTCB;
+            xEDFReadyHeap[ uxIndex ].xDeadline = xDeadline;
+            prvEDFHeapSiftUp( uxIndex );
         }
-        else if( xPendedTicks != 0 )
+        else if( taskEDF_DEADLINE_BEFORE( xDeadline, xEDFReadyHeap[ uxIndex ].xDeadline ) != pdFALSE )
         {
-            /* A tick interrupt has already occurred but was held pending
-             * because the scheduler is suspended. */
-            eReturn = eAbortSleep;
+            xEDFReadyHeap[ uxIndex ].xDeadline = xDeadline;
+            prvEDFHeapSiftUp( uxIndex );
         }
         else
         {
-            /* If all the tasks are in the suspended list (which might mean they
-             * have an infinite block time rather than actually being suspended)
-             * then it is safe to turn all clocks off and just wait for external
-             * interrupts. */
-            if( listCURRENT_LIST_LENGTH( &xSuspendedTaskList ) == ( uxCurrentNumberOfTasks - uxNonApplicationTasks ) )
+            xEDFReadyHeap[ uxIndex ].xDeadline = xDeadline;
+            prvEDFHeapSiftDown( uxIndex );
+        }
+    }
+
+    static void prvEDFHeapRemove( TCB_t * pxTCB )
+    {
+        const UBaseType_t uxIndex = pxTCB->uxEDFHeapIndex;
+
+        if( uxIndex != ( UBaseType_t ) 0U )
+        {
+            pxTCB->uxEDFHeapIndex = ( UBaseType_t ) 0U;
+
+            if( uxIndex != uxEDFReadyHeapSize )
             {
-                eReturn = eNoTasksWaitingTimeout;
+                /* Fill the hole with the last leaf, which can then need to
+                 * move in either direction. */
+                prvEDFHeapSet( uxIndex, &( xEDFReadyHeap[ uxEDFReadyHeapSize ] ) );
+                uxEDFReadyHeapSize--;
+
+                if( ( uxIndex > ( UBaseType_t ) 1U ) && ( taskEDF_DEADLINE_BEFORE( xEDFReadyHeap[ uxIndex ].xDeadline, xEDFReadyHeap[ uxIndex >> 1 ].xDeadline ) != pdFALSE ) )
+                {
+                    prvEDFHeapSiftUp( uxIndex );
+                }
+                else
+                {
+                    prvEDFHeapSiftDown( uxIndex );
+                }
             }
             else
             {
-                mtCOVERAGE_TEST_MARKER();
+                uxEDFReadyHeapSize--;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    static TCB_t * prvEDFHeapGetEarliest( void )
+    {
+        TCB_t * pxTCB = NULL;
+
+        /* Drop any task that has left the Ready state since it was inserted. */
+        while( uxEDFReadyHeapSize > ( UBaseType_t ) 0U )
+        {
+            if( listIS_CONTAINED_WITHIN( &xReadyTasksListEDF, &( xEDFReadyHeap[ 1 ].pxTCB->xStateListItem ) ) != pdFALSE )
+            {
+                pxTCB = xEDFReadyHeap[ 1 ].pxTCB;
+                break;
             }
+
+            prvEDFHeapRemove( xEDFReadyHeap[ 1 ].pxTCB );
         }
 
-        return eReturn;
+        return pxTCB;
     }
 
-#endif /* configUSE_TICKLESS_IDLE */
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_BINARY_HEAP ) */
 /*-----------------------------------------------------------*/
 
-#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_DEADLINE_BUCKETS ) )
 
-    void vTaskSetThreadLocalStoragePointer( TaskHandle_t xTaskToSet,
-                                            BaseType_t xIndex,
-                                            void * pvValue )
+    static void prvEDFBucketInsert( TCB_t * pxTCB )
     {
-        TCB_t * pxTCB;
+        const TickType_t xDeadline = listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) );
+        const UBaseType_t uxBucket = taskEDF_BUCKET_OF( xDeadline );
 
-        if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+        /* A deadline before the floor (a job released late) moves the start
+         * of the search back.  Once the ring has emptied the floor is set
+         * afresh, as nothing else moves it on while the idle task runs. */
+        if( ( ulEDFBucketWords == 0UL ) || ( taskEDF_DEADLINE_BEFORE( xDeadline, xEDFBucketFloor ) != pdFALSE ) )
         {
-            pxTCB = prvGetTCBFromHandle( xTaskToSet );
-            configASSERT( pxTCB != NULL );
-            pxTCB->pvThreadLocalStoragePointers[ xIndex ] = pvValue;
+            xEDFBucketFloor = ( xDeadline >> configEDF_BUCKET_SHIFT ) << configEDF_BUCKET_SHIFT;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
         }
-    }
 
-#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
-/*-----------------------------------------------------------*/
+        configASSERT( ( TickType_t ) ( xDeadline - xEDFBucketFloor ) < taskEDF_BUCKET_WINDOW );
 
-#if ( configNUM_THREAD_LOCAL_STORAGE_POINTERS != 0 )
+        #if ( configEDF_BUCKET_SHIFT == 0 )
+            {
+                /* Every task in the bucket shares the same deadline. */
+                listINSERT_END( &( xEDFReadyBuckets[ uxBucket ] ), &( pxTCB->xStateListItem ) );
+            }
+        #else
+            {
+                /* Keep the few tasks sharing a bucket in exact deadline order. */
+                prvEDFListInsert( &( xEDFReadyBuckets[ uxBucket ] ), NULL, &( pxTCB->xStateListItem ) );
+            }
+        #endif
 
-    void * pvTaskGetThreadLocalStoragePointer( TaskHandle_t xTaskToQuery,
-                                               BaseType_t xIndex )
+        ulEDFBucketBits[ uxBucket >> 5 ] |= ( 1UL << ( uxBucket & 31U ) );
+        ulEDFBucketWords |= ( 1UL << ( uxBucket >> 5 ) );
+    }
+
+    static void prvEDFBucketRemove( TCB_t * pxTCB )
     {
-        void * pvReturn = NULL;
-        TCB_t * pxTCB;
+        const UBaseType_t uxBucket = taskEDF_BUCKET_OF( listGET_LIST_ITEM_VALUE( &( pxTCB->xStateListItem ) ) );
 
-        if( xIndex < configNUM_THREAD_LOCAL_STORAGE_POINTERS )
+        /* Unlike a task that blocks, the caller knows the task is in a bucket,
+         * so the bit can be cleared straight away if the bucket empties. */
+        if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
         {
-            pxTCB = prvGetTCBFromHandle( xTaskToQuery );
-            pvReturn = pxTCB->pvThreadLocalStoragePointers[ xIndex ];
+            ulEDFBucketBits[ uxBucket >> 5 ] &= ~( 1UL << ( uxBucket & 31U ) );
+
+            if( ulEDFBucketBits[ uxBucket >> 5 ] == 0UL )
+            {
+                ulEDFBucketWords &= ~( 1UL << ( uxBucket >> 5 ) );
+            }
         }
         else
         {
-            pvReturn = NULL;
+            mtCOVERAGE_TEST_MARKER();
         }
+    }
 
-        return pvReturn;
+    static TCB_t * prvEDFBucketGetEarliest( void )
+    {
+        const UBaseType_t uxStart = taskEDF_BUCKET_OF( xEDFBucketFloor );
+        const UBaseType_t uxStartWord = uxStart >> 5;
+        UBaseType_t uxWord, uxBucket;
+        uint32_t ulBits;
+        TCB_t * pxTCB = NULL;
+
+        while( ulEDFBucketWords != 0UL )
+        {
+            /* The search runs round the ring from the floor: first the rest
+             * of the floor's own word, then the later words, then wrap. */
+            ulBits = ulEDFBucketBits[ uxStartWord ] & ( 0xFFFFFFFFUL << ( uxStart & 31U ) );
+
+            if( ulBits != 0UL )
+            {
+                uxWord = uxStartWord;
+            }
+            else
+            {
+                ulBits = ( uxStartWord < 31U ) ? ( ulEDFBucketWords & ( 0xFFFFFFFFUL << ( uxStartWord + 1U ) ) ) : 0UL;
+
+                if( ulBits == 0UL )
+                {
+                    ulBits = ulEDFBucketWords;
+                }
+
+                uxWord = taskEDF_LOWEST_SET_BIT( ulBits );
+                ulBits = ulEDFBucketBits[ uxWord ];
+            }
+
+            uxBucket = ( uxWord << 5 ) + taskEDF_LOWEST_SET_BIT( ulBits );
+
+            if( listLIST_IS_EMPTY( &( xEDFReadyBuckets[ uxBucket ] ) ) == pdFALSE )
+            {
+                /* No ready deadline can lie in the buckets skipped over, so
+                 * the floor can advance to the bucket just found. */
+                xEDFBucketFloor = ( listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( xEDFReadyBuckets[ uxBucket ] ) ) >> configEDF_BUCKET_SHIFT ) << configEDF_BUCKET_SHIFT;
+                pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( &( xEDFReadyBuckets[ uxBucket ] ) );
+                break;
+            }
+
+            /* Every task in this bucket has left the Ready state since it was
+             * inserted, so clear the stale bit and look again. */
+            ulEDFBucketBits[ uxWord ] &= ~( 1UL << ( uxBucket & 31U ) );
+
+            if( ulEDFBucketBits[ uxWord ] == 0UL )
+            {
+                ulEDFBucketWords &= ~( 1UL << uxWord );
+            }
+        }
+
+        return pxTCB;
     }
 
-#endif /* configNUM_THREAD_LOCAL_STORAGE_POINTERS */
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_DEADLINE_BUCKETS ) */
 /*-----------------------------------------------------------*/
 
-#if ( portUSING_MPU_WRAPPERS == 1 )
+#if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_TICKLESS_IDLE != 0 ) )
 
-    void vTaskAllocateMPURegions( TaskHandle_t xTaskToModify,
-                                  const MemoryRegion_t * const xRegions )
+    static BaseType_t prvEDFOnlyIdleTaskReady( void )
     {
-        TCB_t * pxTCB;
+        BaseType_t xReturn;
 
-        /* If null is passed in here then we are modifying the MPU settings of
-         * the calling task. */
-        pxTCB = prvGetTCBFromHandle( xTaskToModify );
+        #if ( configEDF_READY_QUEUE == tskEDF_READY_QUEUE_DEADLINE_BUCKETS )
+            {
+                UBaseType_t uxWord, uxBucket, uxReadyTasks = ( UBaseType_t ) 0U;
+                uint32_t ulWords, ulBits;
 
-        vPortStoreTaskMPUSettings( &( pxTCB->xMPUSettings ), xRegions, NULL, 0 );
+                /* The bitmap can still hold bits of buckets emptied by tasks
+                 * that blocked, so count the tasks in the marked buckets and
+                 * drop the stale bits on the way.  This runs from the idle task
+                 * only, never from the tick interrupt. */
+                taskENTER_CRITICAL();
+                {
+                    ulWords = ulEDFBucketWords;
+
+                    while( ulWords != 0UL )
+                    {
+                        uxWord = taskEDF_LOWEST_SET_BIT( ulWords );
+                        ulWords &= ulWords - 1UL;
+                        ulBits = ulEDFBucketBits[ uxWord ];
+
+                        while( ulBits != 0UL )
+                        {
+                            uxBucket = ( uxWord << 5 ) + taskEDF_LOWEST_SET_BIT( ulBits );
+                            ulBits &= ulBits - 1UL;
+
+                            if( listLIST_IS_EMPTY( &( xEDFReadyBuckets[ uxBucket ] ) ) != pdFALSE )
+                            {
+                                ulEDFBucketBits[ uxWord ] &= ~( 1UL << ( uxBucket & 31U ) );
+                            }
+                            else
+                            {
+                                uxReadyTasks += listCURRENT_LIST_LENGTH( &( xEDFReadyBuckets[ uxBucket ] ) );
+                            }
+                        }
+
+                        if( ulEDFBucketBits[ uxWord ] == 0UL )
+                        {
+                            ulEDFBucketWords &= ~( 1UL << uxWord );
+                        }
+                    }
+                }
+                taskEXIT_CRITICAL();
+
+                xReturn = ( uxReadyTasks == ( UBaseType_t ) 0U ) ? pdTRUE : pdFALSE;
+            }
+        #else
+            {
+                xReturn = listLIST_IS_EMPTY( &xReadyTasksListEDF );
+            }
+        #endif
+
+        /* Jobs throttled to the background still have to run. */
+        #if ( taskEDF_BACKGROUND_JOBS )
+            {
+                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) 1U )
+                {
+                    xReturn = pdFALSE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        #endif
+
+        return xReturn;
     }
 
-#endif /* portUSING_MPU_WRAPPERS */
+#endif /* ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_TICKLESS_IDLE != 0 ) */
 /*-----------------------------------------------------------*/
 
-static void prvInitialiseTaskLists( void )
-{
-    UBaseType_t uxPriority;
-	/* E.C. */
-	/* Initialize ready tasks list */
-	#if ( configUSE_EDF_SCHEDULER == 1 )
-	{
-		vListInitialise( &xReadyTasksListEDF );
-	}
-	#endif  
+#if ( configEDF_DELAYED_WHEEL_SLOTS > 0 )
 
-    for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+    static void prvEDFWheelInsert( ListItem_t * const pxStateListItem,
+                                   const TickType_t xConstTickCount )
     {
-        vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
-    }
+        const TickType_t xTimeToWake = listGET_LIST_ITEM_VALUE( pxStateListItem );
+        const TickType_t xTicksToWake = xTimeToWake - xConstTickCount;
+        const ListItem_t * const pxEnd = listGET_END_MARKER( &xEDFDelayedFarList );
+        ListItem_t * pxPrevious = NULL;
+        ListItem_t * pxNext;
+        UBaseType_t uxSlot;
+
+        if( xTicksToWake < ( TickType_t ) configEDF_DELAYED_WHEEL_SLOTS )
+        {
+            /* Every task in a slot wakes on the same tick, so the order within
+             * the slot does not matter. */
+            uxSlot = taskEDF_WHEEL_SLOT_OF( xTimeToWake );
+            listINSERT_END( &( xEDFDelayedWheel[ uxSlot ] ), pxStateListItem );
+            ulEDFWheelBits[ uxSlot >> 5 ] |= ( 1UL << ( uxSlot & 31U ) );
+            ulEDFWheelWords |= ( 1UL << ( uxSlot >> 5 ) );
+        }
+        else
+        {
+            /* vListInsert() orders on the wake time itself, which is wrong once
+             * the wake times straddle an overflow of the tick count, so walk the
+             * far list on the ticks left instead.  Equal times keep their
+             * arrival order. */
+            pxNext = listGET_HEAD_ENTRY( &xEDFDelayedFarList );
 
-    vListInitialise( &xDelayedTaskList1 );
-    vListInitialise( &xDelayedTaskList2 );
-    vListInitialise( &xPendingReadyList );
+            while( ( pxNext != pxEnd ) &&
+                   ( ( TickType_t ) ( listGET_LIST_ITEM_VALUE( pxNext ) - xConstTickCount ) <= xTicksToWake ) )
+            {
+                pxPrevious = pxNext;
+                pxNext = listGET_NEXT( pxNext );
+            }
 
-    #if ( INCLUDE_vTaskDelete == 1 )
-        {
-            vListInitialise( &xTasksWaitingTermination );
+            /* The links of the end marker, a MiniListItem_t, are written
+             * through the list, as in prvEDFListInsert(). */
+            pxStateListItem->pxNext = pxNext;
+
+            if( pxPrevious == NULL )
+            {
+                pxStateListItem->pxPrevious = ( ListItem_t * ) &( xEDFDelayedFarList.xListEnd ); /*lint !e826 !e740 !e9087 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+                xEDFDelayedFarList.xListEnd.pxNext = pxStateListItem;
+            }
+            else
+            {
+                pxStateListItem->pxPrevious = pxPrevious;
+                pxPrevious->pxNext = pxStateListItem;
+            }
+
+            if( pxNext == pxEnd )
+            {
+                xEDFDelayedFarList.xListEnd.pxPrevious = pxStateListItem;
+            }
+            else
+            {
+                pxNext->pxPrevious = pxStateListItem;
+            }
+
+            pxStateListItem->pxContainer = &xEDFDelayedFarList;
+            ( xEDFDelayedFarList.uxNumberOfItems )++;
         }
-    #endif /* INCLUDE_vTaskDelete */
+    }
 
-    #if ( INCLUDE_vTaskSuspend == 1 )
+    static List_t * prvEDFWheelDueList( const TickType_t xConstTickCount )
+    {
+        const ListItem_t * const pxEnd = listGET_END_MARKER( &xEDFDelayedFarList );
+        ListItem_t * pxStateListItem = listGET_HEAD_ENTRY( &xEDFDelayedFarList );
+        ListItem_t * pxNext;
+
+        /* The far list is in order of the ticks left, so the tasks that have
+         * come within one turn of the wheel are all at its head.  The next
+         * item is read before the task moves to the wheel, which relinks it. */
+        while( pxStateListItem != pxEnd )
         {
-            vListInitialise( &xSuspendedTaskList );
+            if( ( TickType_t ) ( listGET_LIST_ITEM_VALUE( pxStateListItem ) - xConstTickCount ) >= ( TickType_t ) configEDF_DELAYED_WHEEL_SLOTS )
+            {
+                break;
+            }
+
+            pxNext = listGET_NEXT( pxStateListItem );
+            ( void ) uxListRemove( pxStateListItem );
+            prvEDFWheelInsert( pxStateListItem, xConstTickCount );
+            pxStateListItem = pxNext;
         }
-    #endif /* INCLUDE_vTaskSuspend */
 
-    /* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
-     * using list2. */
-    pxDelayedTaskList = &xDelayedTaskList1;
-    pxOverflowDelayedTaskList = &xDelayedTaskList2;
-}
+        return &( xEDFDelayedWheel[ taskEDF_WHEEL_SLOT_OF( xConstTickCount ) ] );
+    }
+
+#endif /* configEDF_DELAYED_WHEEL_SLOTS */
 /*-----------------------------------------------------------*/
 
 static void prvCheckTasksWaitingTermination( void )
@@ -3938,6 +7366,21 @@ static void prvCheckTasksWaitingTermination( void )
             }
         #endif
 
+        /* E.C. : The timing of the task, all 0 for a task that is not
+         * periodic, and the deadlines it has missed.  These members are added
+         * to TaskStatus_t in task.h along with the xTaskPeriodicCreate()
+         * prototypes. */
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            {
+                pxTaskStatus->xPeriod = pxTCB->xTaskPeriod;
+                pxTaskStatus->xRelativeDeadline = pxTCB->xTaskRelativeDeadline;
+                pxTaskStatus->xOffset = pxTCB->xTaskOffset;
+                pxTaskStatus->xDeadline = pxTCB->xTaskDeadline;
+                pxTaskStatus->uxDeadlineMisses = pxTCB->uxDeadlineMisses;
+                pxTaskStatus->xMaxLateness = pxTCB->xMaxLateness;
+            }
+        #endif
+
         /* Obtaining the task state is a little fiddly, so is only done if the
          * value of eState passed into this function is eInvalid - otherwise the
          * state is just set to whatever is passed in. */
@@ -3978,7 +7421,7 @@ static void prvCheckTasksWaitingTermination( void )
 
         /* Obtaining the stack space takes some time, so the xGetFreeStackSpace
          * parameter is provided to allow it to be skipped. */
-        if( xGetFreeStackSpace != pdFALSE )
+        if( ( xGetFreeStackSpace != pdFALSE ) && taskEDF_HAS_OWN_STACK( pxTCB ) )
         {
             #if ( portSTACK_GROWTH > 0 )
                 {
@@ -4086,7 +7529,15 @@ static void prvCheckTasksWaitingTermination( void )
             }
         #endif
 
-        uxReturn = prvTaskCheckFreeStackSpace( pucEndOfStack );
+        /* E.C. : A job task waiting for its next job has no stack. */
+        if( taskEDF_HAS_OWN_STACK( pxTCB ) )
+        {
+            uxReturn = prvTaskCheckFreeStackSpace( pucEndOfStack );
+        }
+        else
+        {
+            uxReturn = ( configSTACK_DEPTH_TYPE ) 0;
+        }
 
         return uxReturn;
     }
@@ -4114,7 +7565,15 @@ static void prvCheckTasksWaitingTermination( void )
             }
         #endif
 
-        uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
+        /* E.C. : A job task waiting for its next job has no stack. */
+        if( taskEDF_HAS_OWN_STACK( pxTCB ) )
+        {
+            uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
+        }
+        else
+        {
+            uxReturn = ( UBaseType_t ) 0;
+        }
 
         return uxReturn;
     }
@@ -4182,22 +7641,97 @@ static void prvCheckTasksWaitingTermination( void )
 
 static void prvResetNextTaskUnblockTime( void )
 {
-    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
-    {
-        /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
-         * the maximum possible value so it is  extremely unlikely that the
-         * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
-         * there is an item in the delayed list. */
-        xNextTaskUnblockTime = portMAX_DELAY;
-    }
-    else
-    {
-        /* The new current delayed list is not empty, get the value of
-         * the item at the head of the delayed list.  This is the time at
-         * which the task at the head of the delayed list should be removed
-         * from the Blocked state. */
-        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
-    }
+    #if ( configEDF_DELAYED_WHEEL_SLOTS > 0 )
+        {
+            const UBaseType_t uxStart = taskEDF_WHEEL_SLOT_OF( xTickCount + ( TickType_t ) 1 );
+            const UBaseType_t uxStartWord = uxStart >> 5;
+            TickType_t xTicksToWake = portMAX_DELAY;
+            UBaseType_t uxWord, uxSlot;
+            uint32_t ulBits;
+
+            /* E.C. : Going round the wheel from the next tick, the first slot
+             * that holds tasks holds the earliest wake time on the wheel. */
+            while( ulEDFWheelWords != 0UL )
+            {
+                ulBits = ulEDFWheelBits[ uxStartWord ] & ( 0xFFFFFFFFUL << ( uxStart & 31U ) );
+
+                if( ulBits != 0UL )
+                {
+                    uxWord = uxStartWord;
+                }
+                else
+                {
+                    ulBits = ( uxStartWord < 31U ) ? ( ulEDFWheelWords & ( 0xFFFFFFFFUL << ( uxStartWord + 1U ) ) ) : 0UL;
+
+                    if( ulBits == 0UL )
+                    {
+                        ulBits = ulEDFWheelWords;
+                    }
+
+                    uxWord = taskEDF_LOWEST_SET_BIT( ulBits );
+                    ulBits = ulEDFWheelBits[ uxWord ];
+                }
+
+                uxSlot = ( uxWord << 5 ) + taskEDF_LOWEST_SET_BIT( ulBits );
+
+                if( listLIST_IS_EMPTY( &( xEDFDelayedWheel[ uxSlot ] ) ) == pdFALSE )
+                {
+                    xTicksToWake = listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( xEDFDelayedWheel[ uxSlot ] ) ) - xTickCount;
+                    break;
+                }
+
+                /* The tasks of this slot have all woken, or left the Blocked
+                 * state early, so clear the stale bit and look again. */
+                ulEDFWheelBits[ uxWord ] &= ~( 1UL << ( uxSlot & 31U ) );
+
+                if( ulEDFWheelBits[ uxWord ] == 0UL )
+                {
+                    ulEDFWheelWords &= ~( 1UL << uxWord );
+                }
+            }
+
+            /* A far task that is due within a turn is only moved onto the
+             * wheel when the tick reaches xNextTaskUnblockTime. */
+            if( listLIST_IS_EMPTY( &xEDFDelayedFarList ) == pdFALSE )
+            {
+                if( ( TickType_t ) ( listGET_ITEM_VALUE_OF_HEAD_ENTRY( &xEDFDelayedFarList ) - xTickCount ) < xTicksToWake )
+                {
+                    xTicksToWake = listGET_ITEM_VALUE_OF_HEAD_ENTRY( &xEDFDelayedFarList ) - xTickCount;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* With no task blocked this is a full turn of the tick count away,
+             * where the search simply runs again. */
+            xNextTaskUnblockTime = xTickCount + xTicksToWake;
+        }
+    #else /* configEDF_DELAYED_WHEEL_SLOTS */
+        {
+            if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+            {
+                /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
+                 * the maximum possible value so it is  extremely unlikely that the
+                 * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
+                 * there is an item in the delayed list. */
+                xNextTaskUnblockTime = portMAX_DELAY;
+            }
+            else
+            {
+                /* The new current delayed list is not empty, get the value of
+                 * the item at the head of the delayed list.  This is the time at
+                 * which the task at the head of the delayed list should be removed
+                 * from the Blocked state. */
+                xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+            }
+        }
+    #endif /* configEDF_DELAYED_WHEEL_SLOTS */
 }
 /*-----------------------------------------------------------*/
 
@@ -4246,7 +7780,7 @@ static void prvResetNextTaskUnblockTime( void )
 #endif /* ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
 
     BaseType_t xTaskPriorityInherit( TaskHandle_t const pxMutexHolder )
     {
@@ -4333,10 +7867,10 @@ static void prvResetNextTaskUnblockTime( void )
         return xReturn;
     }
 
-#endif /* configUSE_MUTEXES */
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
 
     BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder )
     {
@@ -4413,10 +7947,10 @@ static void prvResetNextTaskUnblockTime( void )
         return xReturn;
     }
 
-#endif /* configUSE_MUTEXES */
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) )
 
     void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder,
                                               UBaseType_t uxHighestPriorityWaitingTask )
@@ -4519,7 +8053,129 @@ static void prvResetNextTaskUnblockTime( void )
         }
     }
 
-#endif /* configUSE_MUTEXES */
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_EDF_SCHEDULER == 0 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_MUTEXES == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) )
+
+    /* E.C. : Deadline inheritance.  The holder of a mutex that a task with an
+     * earlier deadline blocks on runs by that deadline, as it would have
+     * inherited the priority of the task otherwise, until it has given back
+     * every mutex it holds.  The deadline of its own job is kept, so its
+     * misses, its budget and its next release are not affected. */
+    BaseType_t xTaskPriorityInherit( TaskHandle_t const pxMutexHolder )
+    {
+        TCB_t * const pxMutexHolderTCB = pxMutexHolder;
+        const TickType_t xDeadline = taskEDF_READY_DEADLINE( pxCurrentTCB );
+        BaseType_t xReturn = pdFALSE;
+
+        /* If the mutex was given back by an interrupt while the queue was
+         * locked then the mutex holder might now be NULL. */
+        if( pxMutexHolder != NULL )
+        {
+            if( taskEDF_DEADLINE_BEFORE( xDeadline, taskEDF_READY_DEADLINE( pxMutexHolderTCB ) ) != pdFALSE )
+            {
+                pxMutexHolderTCB->xInheritedDeadline = xDeadline;
+                pxMutexHolderTCB->ucDeadlineInherited = ( uint8_t ) pdTRUE;
+
+                /* A holder in the EDF ready queue moves to the place of the
+                 * deadline it inherited, one in any other state is queued by
+                 * it when it becomes ready again. */
+                if( taskEDF_IN_READY_QUEUE( pxMutexHolderTCB ) != pdFALSE )
+                {
+                    prvEDFSetReadyTaskDeadline( pxMutexHolderTCB, pxMutexHolderTCB->xTaskDeadline );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                traceTASK_PRIORITY_INHERIT( pxMutexHolderTCB, pxCurrentTCB->uxPriority );
+
+                /* Inheritance occurred. */
+                xReturn = pdTRUE;
+            }
+            else if( pxMutexHolderTCB->ucDeadlineInherited != ( uint8_t ) pdFALSE )
+            {
+                /* The holder already runs by a deadline inherited from
+                 * another task, no later than the one of this task. */
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+    /*-----------------------------------------------------------*/
+
+    BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder )
+    {
+        TCB_t * const pxTCB = pxMutexHolder;
+        BaseType_t xReturn = pdFALSE;
+
+        if( pxMutexHolder != NULL )
+        {
+            /* A mutex given by the holding task is given by the running
+             * task. */
+            configASSERT( pxTCB == pxCurrentTCB );
+            configASSERT( pxTCB->uxMutexesHeld );
+            ( pxTCB->uxMutexesHeld )--;
+
+            /* Only disinherit once no other mutexes are held. */
+            if( ( pxTCB->ucDeadlineInherited != ( uint8_t ) pdFALSE ) && ( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 ) )
+            {
+                traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
+                pxTCB->ucDeadlineInherited = ( uint8_t ) pdFALSE;
+
+                /* The task goes back to the place of its own deadline,
+                 * unless its job has been throttled to the background. */
+                if( taskEDF_IN_READY_QUEUE( pxTCB ) != pdFALSE )
+                {
+                    prvEDFSetReadyTaskDeadline( pxTCB, pxTCB->xTaskDeadline );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* A task that was waiting for the mutex may now have the
+                 * earliest deadline. */
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+    /*-----------------------------------------------------------*/
+
+    void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder,
+                                              UBaseType_t uxHighestPriorityWaitingTask )
+    {
+        /* The deadlines of the tasks still waiting for the mutex are not
+         * known here, the value passed in is read from the head of the
+         * event list as if it were a priority.  So the holder keeps the
+         * deadline it inherited until it gives the mutex back, which may run
+         * it early for longer than needed but never late. */
+        ( void ) pxMutexHolder;
+        ( void ) uxHighestPriorityWaitingTask;
+    }
+
+#endif /* ( configUSE_MUTEXES == 1 ) && ( configUSE_EDF_SCHEDULER == 1 ) */
 /*-----------------------------------------------------------*/
 
 #if ( portCRITICAL_NESTING_IN_TCB == 1 )
@@ -5046,6 +8702,10 @@ TickType_t uxTaskResetEventItemValue( void )
         BaseType_t xReturn = pdPASS;
         uint8_t ucOriginalNotifyState;
 
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            BaseType_t xQueued;
+        #endif
+
         configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
         configASSERT( xTaskToNotify );
         pxTCB = xTaskToNotify;
@@ -5111,8 +8771,19 @@ TickType_t uxTaskResetEventItemValue( void )
              * notification then unblock it now. */
             if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
             {
+                traceTASK_UNBLOCKED( pxTCB );
+
                 listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-                prvAddTaskToReadyList( pxTCB );
+
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    {
+                        xQueued = prvAddUnblockedTaskToReadyList( pxTCB );
+                    }
+                #else
+                    {
+                        prvAddTaskToReadyList( pxTCB );
+                    }
+                #endif
 
                 /* The task should not have been on an event list. */
                 configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
@@ -5133,7 +8804,11 @@ TickType_t uxTaskResetEventItemValue( void )
                     }
                 #endif
 
-                if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    if( ( xQueued != pdFALSE ) && ( taskEDF_PREEMPTS_CURRENT( pxTCB ) != pdFALSE ) )
+                #else
+                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                #endif
                 {
                     /* The notified task has a priority above the currently
                      * executing task so a yield is required. */
@@ -5171,6 +8846,12 @@ TickType_t uxTaskResetEventItemValue( void )
         BaseType_t xReturn = pdPASS;
         UBaseType_t uxSavedInterruptStatus;
 
+        /* E.C. : A task held pending is queued by xTaskResumeAll(), which
+         * decides again whether to switch to it. */
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            BaseType_t xQueued = pdTRUE;
+        #endif
+
         configASSERT( xTaskToNotify );
         configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
 
@@ -5253,13 +8934,24 @@ TickType_t uxTaskResetEventItemValue( void )
              * notification then unblock it now. */
             if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
             {
+                traceTASK_UNBLOCKED( pxTCB );
+
                 /* The task should not have been on an event list. */
                 configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
 
                 if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
                 {
                     listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
+
+                    #if ( configUSE_EDF_SCHEDULER == 1 )
+                        {
+                            xQueued = prvAddUnblockedTaskToReadyList( pxTCB );
+                        }
+                    #else
+                        {
+                            prvAddTaskToReadyList( pxTCB );
+                        }
+                    #endif
                 }
                 else
                 {
@@ -5268,7 +8960,11 @@ TickType_t uxTaskResetEventItemValue( void )
                     listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
                 }
 
-                if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    if( ( xQueued != pdFALSE ) && ( taskEDF_PREEMPTS_CURRENT( pxTCB ) != pdFALSE ) )
+                #else
+                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                #endif
                 {
                     /* The notified task has a priority above the currently
                      * executing task so a yield is required. */
@@ -5306,6 +9002,12 @@ TickType_t uxTaskResetEventItemValue( void )
         uint8_t ucOriginalNotifyState;
         UBaseType_t uxSavedInterruptStatus;
 
+        /* E.C. : A task held pending is queued by xTaskResumeAll(), which
+         * decides again whether to switch to it. */
+        #if ( configUSE_EDF_SCHEDULER == 1 )
+            BaseType_t xQueued = pdTRUE;
+        #endif
+
         configASSERT( xTaskToNotify );
         configASSERT( uxIndexToNotify < configTASK_NOTIFICATION_ARRAY_ENTRIES );
 
@@ -5344,13 +9046,24 @@ TickType_t uxTaskResetEventItemValue( void )
              * notification then unblock it now. */
             if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
             {
+                traceTASK_UNBLOCKED( pxTCB );
+
                 /* The task should not have been on an event list. */
                 configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
 
                 if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
                 {
                     listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-                    prvAddTaskToReadyList( pxTCB );
+
+                    #if ( configUSE_EDF_SCHEDULER == 1 )
+                        {
+                            xQueued = prvAddUnblockedTaskToReadyList( pxTCB );
+                        }
+                    #else
+                        {
+                            prvAddTaskToReadyList( pxTCB );
+                        }
+                    #endif
                 }
                 else
                 {
@@ -5359,7 +9072,11 @@ TickType_t uxTaskResetEventItemValue( void )
                     listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
                 }
 
-                if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                #if ( configUSE_EDF_SCHEDULER == 1 )
+                    if( ( xQueued != pdFALSE ) && ( taskEDF_PREEMPTS_CURRENT( pxTCB ) != pdFALSE ) )
+                #else
+                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                #endif
                 {
                     /* The notified task has a priority above the currently
                      * executing task so a yield is required. */
@@ -5490,6 +9207,24 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
     TickType_t xTimeToWake;
     const TickType_t xConstTickCount = xTickCount;
 
+    traceTASK_BLOCKED( xTicksToWait );
+
+    /* E.C. : Under SRP a task holding a resource must not block, or the jobs
+     * held back by the ceiling it raised would wait on it for good. */
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SRP == 1 ) )
+        {
+            configASSERT( pxCurrentTCB->uxSRPResourcesHeld == ( UBaseType_t ) 0U );
+        }
+    #endif
+
+    /* E.C. : A job task runs each job to completion on a shared stack, so
+     * the only wait it may make is xTaskWaitForNextPeriod() at the end. */
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configEDF_JOB_CARRIERS > 0 ) )
+        {
+            configASSERT( ( pxCurrentTCB->pxJobCode == NULL ) || ( pxCurrentTCB->ucEDFJobState == taskEDF_JOB_DONE ) );
+        }
+    #endif
+
     #if ( INCLUDE_xTaskAbortDelay == 1 )
         {
             /* About to enter a delayed list, so ensure the ucDelayAborted flag is
@@ -5499,6 +9234,21 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
         }
     #endif
 
+    /* E.C. : A server whose task blocks has no work pending, so the task
+     * becoming ready again is an arrival. */
+    #if ( ( configUSE_EDF_SCHEDULER == 1 ) && ( configUSE_EDF_SERVERS == 1 ) )
+        {
+            if( pxCurrentTCB->xServerBudget != ( TickType_t ) 0U )
+            {
+                pxCurrentTCB->ucServerIdle = ( uint8_t ) pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif
+
     /* Remove the task from the ready list before adding it to the blocked list
      * as the same list item is used for both lists. */
     if( uxListRemove( &( pxCurrentTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
@@ -5531,30 +9281,49 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
                 /* The list item will be inserted in wake time order. */
                 listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
-                if( xTimeToWake < xConstTickCount )
-                {
-                    /* Wake time has overflowed.  Place this item in the overflow
-                     * list. */
-                    vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
-                }
-                else
-                {
-                    /* The wake time has not overflowed, so the current block list
-                     * is used. */
-                    vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
-
-                    /* If the task entering the blocked state was placed at the
-                     * head of the list of blocked tasks then xNextTaskUnblockTime
-                     * needs to be updated too. */
-                    if( xTimeToWake < xNextTaskUnblockTime )
+                #if ( configEDF_DELAYED_WHEEL_SLOTS > 0 )
                     {
-                        xNextTaskUnblockTime = xTimeToWake;
+                        /* E.C. : O(1) for any delay shorter than a turn of the
+                         * wheel. */
+                        prvEDFWheelInsert( &( pxCurrentTCB->xStateListItem ), xConstTickCount );
+
+                        if( ( xTimeToWake - xConstTickCount ) < ( TickType_t ) ( xNextTaskUnblockTime - xConstTickCount ) )
+                        {
+                            xNextTaskUnblockTime = xTimeToWake;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
                     }
-                    else
+                #else /* configEDF_DELAYED_WHEEL_SLOTS */
                     {
-                        mtCOVERAGE_TEST_MARKER();
+                        if( xTimeToWake < xConstTickCount )
+                        {
+                            /* Wake time has overflowed.  Place this item in the overflow
+                             * list. */
+                            vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+                        }
+                        else
+                        {
+                            /* The wake time has not overflowed, so the current block list
+                             * is used. */
+                            vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+
+                            /* If the task entering the blocked state was placed at the
+                             * head of the list of blocked tasks then xNextTaskUnblockTime
+                             * needs to be updated too. */
+                            if( xTimeToWake < xNextTaskUnblockTime )
+                            {
+                                xNextTaskUnblockTime = xTimeToWake;
+                            }
+                            else
+                            {
+                                mtCOVERAGE_TEST_MARKER();
+                            }
+                        }
                     }
-                }
+                #endif /* configEDF_DELAYED_WHEEL_SLOTS */
             }
         }
     #else /* INCLUDE_vTaskSuspend */
@@ -5567,28 +9336,47 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
             /* The list item will be inserted in wake time order. */
             listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
-            if( xTimeToWake < xConstTickCount )
-            {
-                /* Wake time has overflowed.  Place this item in the overflow list. */
-                vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
-            }
-            else
-            {
-                /* The wake time has not overflowed, so the current block list is used. */
-                vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
-
-                /* If the task entering the blocked state was placed at the head of the
-                 * list of blocked tasks then xNextTaskUnblockTime needs to be updated
-                 * too. */
-                if( xTimeToWake < xNextTaskUnblockTime )
+            #if ( configEDF_DELAYED_WHEEL_SLOTS > 0 )
                 {
-                    xNextTaskUnblockTime = xTimeToWake;
+                    /* E.C. : O(1) for any delay shorter than a turn of the
+                     * wheel. */
+                    prvEDFWheelInsert( &( pxCurrentTCB->xStateListItem ), xConstTickCount );
+
+                    if( ( xTimeToWake - xConstTickCount ) < ( TickType_t ) ( xNextTaskUnblockTime - xConstTickCount ) )
+                    {
+                        xNextTaskUnblockTime = xTimeToWake;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
                 }
-                else
+            #else /* configEDF_DELAYED_WHEEL_SLOTS */
                 {
-                    mtCOVERAGE_TEST_MARKER();
+                    if( xTimeToWake < xConstTickCount )
+                    {
+                        /* Wake time has overflowed.  Place this item in the overflow list. */
+                        vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+                    }
+                    else
+                    {
+                        /* The wake time has not overflowed, so the current block list is used. */
+                        vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xStateListItem ) );
+
+                        /* If the task entering the blocked state was placed at the head of the
+                         * list of blocked tasks then xNextTaskUnblockTime needs to be updated
+                         * too. */
+                        if( xTimeToWake < xNextTaskUnblockTime )
+                        {
+                            xNextTaskUnblockTime = xTimeToWake;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
                 }
-            }
+            #endif /* configEDF_DELAYED_WHEEL_SLOTS */
 
             /* Avoid compiler warning when INCLUDE_vTaskSuspend is not 1. */
             ( void ) xCanBlockIndefinitely;
@@ -0,0 +1,614 @@
+/*
+ * E.C. : Host decoder for the scheduler trace recorded by main.c.
+ *
+ * Reads one or more memory dumps of xTraceBuffer, taken in order during the
+ * same run, and writes a Chrome / Perfetto JSON timeline to stdout:
+ *  - a track per task with a bar for every time the task ran,
+ *  - a job track per task with a bar from each release to the completion of
+ *    the job, and markers for the releases, deadlines and deadline misses.
+ * The response time, jitter and utilisation of every task are printed to
+ * stderr.
+ *
+ * A dump is either the raw bytes of xTraceBuffer or the Intel HEX file the
+ * uVision debugger writes with
+ *     SAVE trace.hex &xTraceBuffer, ((char *) &xTraceBuffer) + sizeof(xTraceBuffer) - 1
+ * Dumps taken one after the other are joined on the record numbers, so a run
+ * of any length can be followed as long as the buffer does not wrap between
+ * two dumps.
+ *
+ * This runs on the host, not on the target:
+ *     cc -O2 -o trace_decode trace_decode.c
+ *     ./trace_decode trace1.hex trace2.hex > schedule.json
+ * then open schedule.json in https://ui.perfetto.dev or chrome://tracing.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* Must match xTraceBuffer and the TRACE_ events of FreeRTOSConfig.h. */
+#define traceMAGIC              ( 0x54464445UL )
+#define traceHEADER_SIZE        ( 9 * 4 )
+#define traceRECORD_SIZE        ( 12 )
+
+#define TRACE_SWITCH_IN         ( 1 )
+#define TRACE_SWITCH_OUT        ( 2 )
+#define TRACE_RELEASE           ( 3 )
+#define TRACE_DEADLINE          ( 4 )
+#define TRACE_BLOCK             ( 5 )
+#define TRACE_UNBLOCK           ( 6 )
+
+#define decodeMAX_SLOTS         ( 256 )
+#define decodeJOB_TRACK         ( 1000 )
+
+typedef struct
+{
+	char pcName[ 64 ];
+	int xSeen;
+
+	/* Run in progress. */
+	int xRunning;
+	uint64_t ullRunStart;
+
+	/* Job in progress. */
+	int xJobOpen;
+	int xJobStarted;
+	int xJobBlocked;
+	int xDeadlineKnown;
+	uint32_t ulJob;
+	uint32_t ulReleaseTick;
+	uint64_t ullRelease;
+	uint64_t ullDeadline;
+	uint64_t ullLastBlock;
+
+	/* Totals. */
+	uint64_t ullExecution;
+	uint32_t ulJobs;
+	uint32_t ulMisses;
+	double dResponseMin, dResponseMax, dResponseSum;
+	double dStartMin, dStartMax;
+} Task_t;
+
+static Task_t xTasks[ decodeMAX_SLOTS ];
+static uint32_t ulTimestampHz, ulTickHz;
+static uint64_t ullNow, ullFirst;
+static uint32_t ulLastTimestamp;
+static int xHaveTime, xFirstEvent = 1;
+
+/*-----------------------------------------------------------*/
+
+static uint32_t prvRead32( const uint8_t * pucBytes )
+{
+	/* The LPC2129 is little endian. */
+	return ( uint32_t ) pucBytes[ 0 ] | ( ( uint32_t ) pucBytes[ 1 ] << 8 ) |
+		   ( ( uint32_t ) pucBytes[ 2 ] << 16 ) | ( ( uint32_t ) pucBytes[ 3 ] << 24 );
+}
+
+static int prvHexByte( const char * pcText )
+{
+	unsigned int uxByte;
+
+	if( sscanf( pcText, "%2x", &uxByte ) != 1 )
+	{
+		return -1;
+	}
+
+	return ( int ) uxByte;
+}
+
+/* Grows the buffer of a dump to hold at least xNeeded bytes.  The new bytes
+are zeroed, so the gaps a HEX file leaves between its records read as zero.
+Returns 0 if there is no memory left. */
+static int prvGrowDump( uint8_t ** ppucData, size_t * pxCapacity, size_t xNeeded )
+{
+	size_t xCapacity = ( *pxCapacity == 0 ) ? 65536 : *pxCapacity;
+	uint8_t * pucData;
+
+	while( xCapacity < xNeeded )
+	{
+		xCapacity *= 2U;
+	}
+
+	pucData = realloc( *ppucData, xCapacity );
+
+	if( pucData == NULL )
+	{
+		return 0;
+	}
+
+	memset( &pucData[ *pxCapacity ], 0, xCapacity - *pxCapacity );
+	*ppucData = pucData;
+	*pxCapacity = xCapacity;
+
+	return 1;
+}
+
+/* Loads a raw or Intel HEX dump.  The HEX data is placed relative to the
+first address it holds, data below that address is refused. */
+static uint8_t * prvLoadDump( const char * pcPath, size_t * pxLength )
+{
+	FILE * pxFile = fopen( pcPath, "rb" );
+	uint8_t * pucData = NULL;
+	size_t xLength = 0, xCapacity = 0;
+	int c, xFailed = 0;
+
+	if( pxFile == NULL )
+	{
+		perror( pcPath );
+		return NULL;
+	}
+
+	c = fgetc( pxFile );
+
+	if( c == ':' )
+	{
+		char pcLine[ 600 ];
+		uint32_t ulUpper = 0, ulBase = 0;
+		int xHaveBase = 0;
+
+		ungetc( c, pxFile );
+
+		while( fgets( pcLine, sizeof( pcLine ), pxFile ) != NULL )
+		{
+			int xCount, xType, i;
+			uint32_t ulAddress, ulOffset;
+
+			if( pcLine[ 0 ] != ':' )
+			{
+				continue;
+			}
+
+			xCount = prvHexByte( &pcLine[ 1 ] );
+			ulAddress = ( uint32_t ) ( ( prvHexByte( &pcLine[ 3 ] ) << 8 ) | prvHexByte( &pcLine[ 5 ] ) );
+			xType = prvHexByte( &pcLine[ 7 ] );
+
+			if( ( xCount < 0 ) || ( strlen( pcLine ) < ( size_t ) ( 11 + ( 2 * xCount ) ) ) )
+			{
+				fprintf( stderr, "%s: bad HEX record\n", pcPath );
+				break;
+			}
+
+			if( xType == 0x01 )
+			{
+				break;
+			}
+			else if( xType == 0x02 )
+			{
+				ulUpper = ( uint32_t ) ( ( prvHexByte( &pcLine[ 9 ] ) << 8 ) | prvHexByte( &pcLine[ 11 ] ) ) << 4;
+			}
+			else if( xType == 0x04 )
+			{
+				ulUpper = ( uint32_t ) ( ( prvHexByte( &pcLine[ 9 ] ) << 8 ) | prvHexByte( &pcLine[ 11 ] ) ) << 16;
+			}
+			else if( xType == 0x00 )
+			{
+				ulAddress += ulUpper;
+
+				if( xHaveBase == 0 )
+				{
+					ulBase = ulAddress;
+					xHaveBase = 1;
+				}
+
+				if( ulAddress < ulBase )
+				{
+					fprintf( stderr, "%s: data at 0x%08X is below the first record at 0x%08X\n", pcPath, ulAddress, ulBase );
+					xFailed = 1;
+					break;
+				}
+
+				ulOffset = ulAddress - ulBase;
+
+				if( ( ( size_t ) ulOffset + ( size_t ) xCount > xCapacity ) &&
+					( prvGrowDump( &pucData, &xCapacity, ( size_t ) ulOffset + ( size_t ) xCount ) == 0 ) )
+				{
+					fprintf( stderr, "%s: out of memory\n", pcPath );
+					xFailed = 1;
+					break;
+				}
+
+				for( i = 0; i < xCount; i++ )
+				{
+					pucData[ ulOffset + ( uint32_t ) i ] = ( uint8_t ) prvHexByte( &pcLine[ 9 + ( 2 * i ) ] );
+				}
+
+				if( ulOffset + ( uint32_t ) xCount > xLength )
+				{
+					xLength = ulOffset + ( uint32_t ) xCount;
+				}
+			}
+		}
+	}
+	else
+	{
+		while( c != EOF )
+		{
+			if( ( xLength == xCapacity ) && ( prvGrowDump( &pucData, &xCapacity, xLength + 1U ) == 0 ) )
+			{
+				fprintf( stderr, "%s: out of memory\n", pcPath );
+				xFailed = 1;
+				break;
+			}
+
+			pucData[ xLength++ ] = ( uint8_t ) c;
+			c = fgetc( pxFile );
+		}
+	}
+
+	fclose( pxFile );
+
+	if( xFailed != 0 )
+	{
+		free( pucData );
+		return NULL;
+	}
+
+	*pxLength = xLength;
+
+	return pucData;
+}
+
+/*-----------------------------------------------------------*/
+
+static double prvMicroseconds( uint64_t ullCounts )
+{
+	return ( ( double ) ( ullCounts - ullFirst ) * 1000000.0 ) / ( double ) ulTimestampHz;
+}
+
+static double prvMilliseconds( double dCounts )
+{
+	return ( dCounts * 1000.0 ) / ( double ) ulTimestampHz;
+}
+
+static void prvEmit( const char * pcEvent )
+{
+	printf( "%s\n%s", xFirstEvent ? "" : ",", pcEvent );
+	xFirstEvent = 0;
+}
+
+static void prvEmitBar( const char * pcName, uint32_t ulTrack, uint64_t ullStart, uint64_t ullEnd, const char * pcArgs )
+{
+	char pcEvent[ 512 ];
+
+	snprintf( pcEvent, sizeof( pcEvent ),
+			  "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{%s}}",
+			  pcName, ulTrack, prvMicroseconds( ullStart ), prvMicroseconds( ullEnd ) - prvMicroseconds( ullStart ), pcArgs );
+	prvEmit( pcEvent );
+}
+
+static void prvEmitMarker( const char * pcName, uint32_t ulTrack, uint64_t ullTime, const char * pcArgs )
+{
+	char pcEvent[ 512 ];
+
+	snprintf( pcEvent, sizeof( pcEvent ),
+			  "{\"name\":\"%s\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"args\":{%s}}",
+			  pcName, ulTrack, prvMicroseconds( ullTime ), pcArgs );
+	prvEmit( pcEvent );
+}
+
+static void prvEmitTrackName( uint32_t ulTrack, const char * pcName, uint32_t ulOrder )
+{
+	char pcEvent[ 256 ];
+
+	snprintf( pcEvent, sizeof( pcEvent ),
+			  "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%.80s\"}},\n"
+			  "{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"sort_index\":%u}}",
+			  ulTrack, pcName, ulTrack, ulOrder );
+	prvEmit( pcEvent );
+}
+
+/*-----------------------------------------------------------*/
+
+/* Closes the job in progress of a task.  The job completed when the task last
+blocked, unless it was unblocked again, and a job still running or ready ran
+into the next release.  Either way it missed only if it completed after its
+deadline, a job whose deadline was not traced is not judged. */
+static void prvFinishJob( Task_t * pxTask, uint32_t ulSlot, uint64_t ullNextRelease )
+{
+	char pcArgs[ 128 ], pcName[ 96 ];
+	uint64_t ullCompletion;
+	double dResponse;
+	int xMissed;
+
+	if( pxTask->xJobOpen == 0 )
+	{
+		return;
+	}
+
+	pxTask->xJobOpen = 0;
+	ullCompletion = ( pxTask->xJobBlocked != 0 ) ? pxTask->ullLastBlock : ullNextRelease;
+	xMissed = ( pxTask->xDeadlineKnown != 0 ) && ( ullCompletion > pxTask->ullDeadline );
+	dResponse = ( double ) ( ullCompletion - pxTask->ullRelease );
+
+	snprintf( pcName, sizeof( pcName ), "%.63s #%u", pxTask->pcName, pxTask->ulJob );
+	snprintf( pcArgs, sizeof( pcArgs ), "\"response_ms\":%.3f,\"missed\":%s",
+			  prvMilliseconds( dResponse ), xMissed ? "true" : "false" );
+	prvEmitBar( pcName, decodeJOB_TRACK + ulSlot, pxTask->ullRelease, ullCompletion, pcArgs );
+
+	if( xMissed != 0 )
+	{
+		pxTask->ulMisses++;
+		prvEmitMarker( "deadline miss", decodeJOB_TRACK + ulSlot, pxTask->ullDeadline, pcArgs );
+	}
+
+	if( pxTask->ulJobs == 0 )
+	{
+		pxTask->dResponseMin = dResponse;
+		pxTask->dResponseMax = dResponse;
+	}
+	else
+	{
+		pxTask->dResponseMin = ( dResponse < pxTask->dResponseMin ) ? dResponse : pxTask->dResponseMin;
+		pxTask->dResponseMax = ( dResponse > pxTask->dResponseMax ) ? dResponse : pxTask->dResponseMax;
+	}
+
+	pxTask->dResponseSum += dResponse;
+	pxTask->ulJobs++;
+}
+
+static void prvDecodeRecord( const uint8_t * pucRecord )
+{
+	const uint32_t ulTimestamp = prvRead32( &pucRecord[ 0 ] );
+	const uint32_t ulValue = prvRead32( &pucRecord[ 4 ] );
+	const uint8_t ucEvent = pucRecord[ 8 ];
+	const uint32_t ulSlot = pucRecord[ 9 ];
+	Task_t * const pxTask = &( xTasks[ ulSlot ] );
+	char pcArgs[ 64 ];
+	double dLatency;
+
+	/* T1TC wraps, so add up the differences between records. */
+	if( xHaveTime == 0 )
+	{
+		ullNow = ulTimestamp;
+		ullFirst = ullNow;
+		xHaveTime = 1;
+	}
+	else
+	{
+		ullNow += ( uint32_t ) ( ulTimestamp - ulLastTimestamp );
+	}
+
+	ulLastTimestamp = ulTimestamp;
+	pxTask->xSeen = 1;
+
+	switch( ucEvent )
+	{
+		case TRACE_SWITCH_IN:
+			pxTask->xRunning = 1;
+			pxTask->ullRunStart = ullNow;
+
+			if( ( pxTask->xJobOpen != 0 ) && ( pxTask->xJobStarted == 0 ) )
+			{
+				pxTask->xJobStarted = 1;
+				dLatency = ( double ) ( ullNow - pxTask->ullRelease );
+
+				if( pxTask->ulJobs == 0 )
+				{
+					pxTask->dStartMin = dLatency;
+					pxTask->dStartMax = dLatency;
+				}
+				else
+				{
+					pxTask->dStartMin = ( dLatency < pxTask->dStartMin ) ? dLatency : pxTask->dStartMin;
+					pxTask->dStartMax = ( dLatency > pxTask->dStartMax ) ? dLatency : pxTask->dStartMax;
+				}
+			}
+			break;
+
+		case TRACE_SWITCH_OUT:
+			/* A trace that starts in the middle of a run has no switch in. */
+			if( pxTask->xRunning != 0 )
+			{
+				pxTask->xRunning = 0;
+				pxTask->ullExecution += ullNow - pxTask->ullRunStart;
+				prvEmitBar( pxTask->pcName, ulSlot, pxTask->ullRunStart, ullNow, "" );
+			}
+			break;
+
+		case TRACE_RELEASE:
+			prvFinishJob( pxTask, ulSlot, ullNow );
+			pxTask->xJobOpen = 1;
+			pxTask->xJobStarted = 0;
+			pxTask->xJobBlocked = 0;
+			pxTask->xDeadlineKnown = 0;
+			pxTask->ulJob++;
+			pxTask->ulReleaseTick = ulValue;
+			pxTask->ullRelease = ullNow;
+			pxTask->ullDeadline = ullNow;
+			snprintf( pcArgs, sizeof( pcArgs ), "\"tick\":%u", ulValue );
+			prvEmitMarker( "release", decodeJOB_TRACK + ulSlot, ullNow, pcArgs );
+			break;
+
+		case TRACE_DEADLINE:
+			if( pxTask->xJobOpen != 0 )
+			{
+				/* The deadline is in ticks, counted from the release tick. */
+				pxTask->ullDeadline = pxTask->ullRelease +
+									  ( ( uint64_t ) ( uint32_t ) ( ulValue - pxTask->ulReleaseTick ) * ulTimestampHz ) / ulTickHz;
+				pxTask->xDeadlineKnown = 1;
+				snprintf( pcArgs, sizeof( pcArgs ), "\"tick\":%u", ulValue );
+				prvEmitMarker( "deadline", decodeJOB_TRACK + ulSlot, pxTask->ullDeadline, pcArgs );
+			}
+			break;
+
+		case TRACE_BLOCK:
+			if( pxTask->xJobOpen != 0 )
+			{
+				pxTask->xJobBlocked = 1;
+				pxTask->ullLastBlock = ullNow;
+			}
+			break;
+
+		case TRACE_UNBLOCK:
+			/* The job went on after the block, so it was not the end. */
+			pxTask->xJobBlocked = 0;
+			break;
+
+		default:
+			fprintf( stderr, "unknown event %u\n", ( unsigned int ) ucEvent );
+			break;
+	}
+}
+
+/* Decodes the records of one dump that follow ulDone, the number of records
+already decoded from earlier dumps.  Returns the new count. */
+static uint32_t prvDecodeDump( const char * pcPath, const uint8_t * pucDump, size_t xLength, uint32_t ulDone, int xFirstDump )
+{
+	uint32_t ulRecordSize, ulRecords, ulSlots, ulNameLength, ulWritten, ulOldest, ulIndex, ulSlot;
+	size_t xRecordsOffset;
+	const uint8_t * pucRecord;
+
+	if( ( xLength < traceHEADER_SIZE ) || ( prvRead32( &pucDump[ 0 ] ) != traceMAGIC ) )
+	{
+		fprintf( stderr, "%s: not a dump of xTraceBuffer\n", pcPath );
+		return ulDone;
+	}
+
+	ulRecordSize = prvRead32( &pucDump[ 4 ] );
+	ulRecords = prvRead32( &pucDump[ 8 ] );
+	ulSlots = prvRead32( &pucDump[ 12 ] );
+	ulNameLength = prvRead32( &pucDump[ 16 ] );
+	ulTimestampHz = prvRead32( &pucDump[ 20 ] );
+	ulTickHz = prvRead32( &pucDump[ 24 ] );
+	ulWritten = prvRead32( &pucDump[ 32 ] );
+	xRecordsOffset = ( traceHEADER_SIZE + ( ( size_t ) ulSlots * ulNameLength ) + 3U ) & ~( size_t ) 3U;
+
+	if( ( ulRecordSize != traceRECORD_SIZE ) || ( ulSlots > decodeMAX_SLOTS ) || ( ulTimestampHz == 0 ) || ( ulTickHz == 0 ) ||
+		( xLength < xRecordsOffset + ( ( size_t ) ulRecords * ulRecordSize ) ) )
+	{
+		fprintf( stderr, "%s: truncated or unexpected layout\n", pcPath );
+		return ulDone;
+	}
+
+	for( ulSlot = 0; ulSlot < ulSlots; ulSlot++ )
+	{
+		const char * pcName = ( const char * ) &pucDump[ traceHEADER_SIZE + ( ulSlot * ulNameLength ) ];
+
+		if( ( pcName[ 0 ] != '\0' ) && ( xTasks[ ulSlot ].pcName[ 0 ] == '\0' ) )
+		{
+			snprintf( xTasks[ ulSlot ].pcName, sizeof( xTasks[ ulSlot ].pcName ), "%.*s", ( int ) ulNameLength, pcName );
+		}
+		else if( xTasks[ ulSlot ].pcName[ 0 ] == '\0' )
+		{
+			snprintf( xTasks[ ulSlot ].pcName, sizeof( xTasks[ ulSlot ].pcName ), ( ulSlot == 0 ) ? "other" : "slot %u", ulSlot );
+		}
+	}
+
+	/* Only the last ulRecords records are still held. */
+	ulOldest = ( ulWritten > ulRecords ) ? ( ulWritten - ulRecords ) : 0U;
+
+	if( ( xFirstDump == 0 ) && ( ulOldest > ulDone ) )
+	{
+		fprintf( stderr, "%s: %u records were lost since the previous dump\n", pcPath, ulOldest - ulDone );
+	}
+
+	if( ulDone > ulOldest )
+	{
+		ulOldest = ulDone;
+	}
+
+	for( ulIndex = ulOldest; ulIndex != ulWritten; ulIndex++ )
+	{
+		pucRecord = &pucDump[ xRecordsOffset + ( ( size_t ) ( ulIndex % ulRecords ) * ulRecordSize ) ];
+
+		/* The target can overwrite the oldest records while it is dumped. */
+		if( ( uint32_t ) ( pucRecord[ 10 ] | ( pucRecord[ 11 ] << 8 ) ) != ( ulIndex & 0xFFFFU ) )
+		{
+			continue;
+		}
+
+		prvDecodeRecord( pucRecord );
+	}
+
+	return ulWritten;
+}
+
+/*-----------------------------------------------------------*/
+
+int main( int argc, char ** argv )
+{
+	uint32_t ulDone = 0, ulSlot;
+	uint8_t * pucDump;
+	size_t xLength;
+	double dSpan, dBusy = 0.0;
+	int i;
+
+	if( argc < 2 )
+	{
+		fprintf( stderr, "usage: %s dump [dump ...] > schedule.json\n", argv[ 0 ] );
+		return 1;
+	}
+
+	printf( "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[" );
+
+	for( i = 1; i < argc; i++ )
+	{
+		pucDump = prvLoadDump( argv[ i ], &xLength );
+
+		if( pucDump != NULL )
+		{
+			ulDone = prvDecodeDump( argv[ i ], pucDump, xLength, ulDone, i == 1 );
+			free( pucDump );
+		}
+	}
+
+	for( ulSlot = 0; ulSlot < decodeMAX_SLOTS; ulSlot++ )
+	{
+		if( xTasks[ ulSlot ].xSeen != 0 )
+		{
+			char pcName[ 96 ];
+
+			prvEmitTrackName( ulSlot, xTasks[ ulSlot ].pcName, ulSlot * 2U );
+			snprintf( pcName, sizeof( pcName ), "%.63s jobs", xTasks[ ulSlot ].pcName );
+			prvEmitTrackName( decodeJOB_TRACK + ulSlot, pcName, ( ulSlot * 2U ) + 1U );
+		}
+	}
+
+	printf( "\n]}\n" );
+
+	/* Summary. */
+	dSpan = ( double ) ( ullNow - ullFirst );
+
+	if( ( xHaveTime == 0 ) || ( dSpan <= 0.0 ) )
+	{
+		fprintf( stderr, "no records\n" );
+		return 1;
+	}
+
+	fprintf( stderr, "trace of %.3f ms\n", prvMilliseconds( dSpan ) );
+	fprintf( stderr, "%-12s %6s %6s %28s %12s %12s %7s\n", "task", "jobs", "misses",
+			 "response min/avg/max ms", "resp jitter", "start jitter", "util %" );
+
+	for( ulSlot = 0; ulSlot < decodeMAX_SLOTS; ulSlot++ )
+	{
+		const Task_t * const pxTask = &( xTasks[ ulSlot ] );
+
+		if( pxTask->xSeen == 0 )
+		{
+			continue;
+		}
+
+		if( pxTask->ulJobs > 0 )
+		{
+			fprintf( stderr, "%-12s %6u %6u %8.3f /%8.3f /%8.3f %12.3f %12.3f %7.2f\n", pxTask->pcName, pxTask->ulJobs, pxTask->ulMisses,
+					 prvMilliseconds( pxTask->dResponseMin ), prvMilliseconds( pxTask->dResponseSum / pxTask->ulJobs ), prvMilliseconds( pxTask->dResponseMax ),
+					 prvMilliseconds( pxTask->dResponseMax - pxTask->dResponseMin ), prvMilliseconds( pxTask->dStartMax - pxTask->dStartMin ),
+					 ( 100.0 * ( double ) pxTask->ullExecution ) / dSpan );
+		}
+		else
+		{
+			fprintf( stderr, "%-12s %6s %6s %28s %12s %12s %7.2f\n", pxTask->pcName, "-", "-", "-", "-", "-",
+					 ( 100.0 * ( double ) pxTask->ullExecution ) / dSpan );
+		}
+
+		if( strcmp( pxTask->pcName, "IDLE" ) != 0 )
+		{
+			dBusy += ( double ) pxTask->ullExecution;
+		}
+	}
+
+	fprintf( stderr, "total utilisation without the idle task: %.2f %%\n", ( 100.0 * dBusy ) / dSpan );
+
+	return 0;
+}